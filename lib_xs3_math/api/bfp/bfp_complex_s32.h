@@ -211,6 +211,44 @@ void bfp_complex_s32_real_mul(
     const bfp_s32_t* c);
 
 
+/**
+ * @brief Apply a real gain vector to a complex 32-bit BFP vector.
+ * 
+ * Each complex output element @math{A_k} of complex output BFP vector @vector{A} is set to the 
+ * product of @math{B_k}, the corresponding element of complex input BFP vector @vector{B}, and 
+ * @math{G_k}, the corresponding element of real gain BFP vector @vector{G}.
+ * 
+ * This computes the same result as bfp_complex_s32_real_mul(), and is intended for gain vectors
+ * such as those produced by bfp_s32_wiener_gain(). The output exponent is chosen using the headroom
+ * of both @vector{B} and @vector{G}, so small gains do not reduce the precision of the output.
+ * 
+ * `a`, `b` and `gain` must have been initialized (see bfp_s32_init() and 
+ * bfp_complex_s32_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow B_k \cdot G_k                                   \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                    \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B} \text{ and } \bar{G}
+ * }
+ * 
+ * @param[out] a        Output complex BFP vector @vector{A}
+ * @param[in]  b        Input complex BFP vector @vector{B}
+ * @param[in]  gain     Input real gain BFP vector @vector{G}
+ * 
+ * @see bfp_complex_s32_real_mul,
+ *      bfp_s32_wiener_gain
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_apply_gain(
+    bfp_complex_s32_t* a, 
+    const bfp_complex_s32_t* b, 
+    const bfp_s32_t* gain);
+
+
 /** 
  * @brief Multiply one complex 32-bit BFP vector element-wise by another.
  * 
@@ -658,4 +696,307 @@ void bfp_complex_s32_conjugate(
  */
 C_API
 float_s64_t bfp_complex_s32_energy(
-    const bfp_complex_s32_t* b);
\ No newline at end of file
+    const bfp_complex_s32_t* b);
+
+
+/**
+ * @brief Get the headroom of a planar complex 32-bit BFP vector.
+ * 
+ * The headroom of a planar complex vector is the smaller of the headrooms of its real and imaginary
+ * mantissa buffers. As well as being returned, it is stored in `a->hr`.
+ * 
+ * @param[inout] a  Planar complex BFP vector to get the headroom of
+ * 
+ * @returns Headroom of the planar complex BFP vector
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+headroom_t bfp_complex_s32_planar_headroom(
+    bfp_complex_s32_planar_t* a);
+
+
+/**
+ * @brief Convert an interleaved complex 32-bit BFP vector into a planar one.
+ * 
+ * The real parts of the mantissas of @vector{B} are copied into `a->real[]` and the imaginary parts 
+ * into `a->imag[]`. The exponent and headroom are unchanged. This is typically used on the output of
+ * one of the FFT functions before a chain of planar element-wise operations.
+ * 
+ * `a` and `b` must have been initialized, must be the same length, and must not share memory.
+ * 
+ * @param[out] a     Output planar complex BFP vector @vector{A}
+ * @param[in]  b     Input complex BFP vector @vector{B}
+ * 
+ * @see bfp_complex_s32_from_planar
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_to_planar(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_t* b);
+
+
+/**
+ * @brief Convert a planar complex 32-bit BFP vector into an interleaved one.
+ * 
+ * This is the inverse of bfp_complex_s32_to_planar(). The exponent and headroom are unchanged. 
+ * 
+ * `a` and `b` must have been initialized, must be the same length, and must not share memory.
+ * 
+ * @param[out] a     Output complex BFP vector @vector{A}
+ * @param[in]  b     Input planar complex BFP vector @vector{B}
+ * 
+ * @see bfp_complex_s32_to_planar
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_from_planar(
+    bfp_complex_s32_t* a, 
+    const bfp_complex_s32_planar_t* b);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit BFP vector element-wise by another.
+ * 
+ * This is the planar counterpart of bfp_complex_s32_mul(), and gives identical results.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_complex_s32_planar_init()), and must be the 
+ * same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @operation{
+ * &    A_k \leftarrow B_k \cdot C_k                                                    \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)                                       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}
+ * }
+ * 
+ * @param[out] a     Output planar complex BFP vector @vector{A}
+ * @param[in]  b     Input planar complex BFP vector @vector{B}
+ * @param[in]  c     Input planar complex BFP vector @vector{C}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_planar_mul(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit BFP vector element-wise by the complex conjugate of 
+ * another.
+ * 
+ * This is the planar counterpart of bfp_complex_s32_conj_mul(), and gives identical results.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_complex_s32_planar_init()), and must be the 
+ * same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @operation{
+ * &    A_k \leftarrow B_k \cdot (C_k)^*                                                \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)                                       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}  \\
+ * &        \qquad\text{and } (C_k)^* \text{ is the complex conjugate of } C_k
+ * }
+ * 
+ * @param[out] a     Output planar complex BFP vector @vector{A}
+ * @param[in]  b     Input planar complex BFP vector @vector{B}
+ * @param[in]  c     Input planar complex BFP vector @vector{C}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_planar_conj_mul(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit BFP vector by another element-wise and add the result 
+ * to a third vector.
+ * 
+ * This is the planar counterpart of bfp_complex_s32_macc(), and gives identical results.
+ * 
+ * @operation{
+ * &    A_k \leftarrow A_k + (B_k \cdot C_k)            \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}
+ * }
+ * 
+ * @param[inout]  acc   Input/Output accumulator planar complex BFP vector @vector{A}
+ * @param[in]     b     Input planar complex BFP vector @vector{B}
+ * @param[in]     c     Input planar complex BFP vector @vector{C}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_planar_macc(
+    bfp_complex_s32_planar_t* acc, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c);
+
+
+/**
+ * @brief Get the magnitude of each element of a planar complex 32-bit BFP vector.
+ * 
+ * This is the planar counterpart of bfp_complex_s32_mag(), and gives identical results.
+ * 
+ * @operation{
+ * &    A_k \leftarrow  \left| B_k \right|                  \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)           \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{A}\text{ and }\bar{B}
+ * }
+ * 
+ * @param[out] a     Output real BFP vector @vector{A}
+ * @param[in]  b     Input planar complex BFP vector @vector{B}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_planar_mag(
+    bfp_s32_t* a, 
+    const bfp_complex_s32_planar_t* b);
+
+
+/**
+ * @brief Update an exponentially smoothed cross-power spectrum with one frame.
+ * 
+ * Each element @math{A_k} of complex accumulator BFP vector @vector{A} is updated with the
+ * conjugate product of @math{B_k} and @math{C_k}, the corresponding elements of complex input BFP
+ * vectors @vector{B} and @vector{C}, using an exponential moving average with coefficient 
+ * @math{\alpha}. 
+ * 
+ * This is the per-frame update of a smoothed cross-power spectrum (one entry of a spatial 
+ * covariance matrix). It gives the same result as bfp_complex_s32_conj_mul(), 
+ * bfp_complex_s32_real_scale() and bfp_complex_s32_add() in sequence, but in one pass and without 
+ * a temporary vector.
+ * 
+ * `alpha_q30` is @math{\alpha} in Q30 format, and must be in the range @math{0 \leq \alpha \leq 1}
+ * (i.e. `0` to `0x40000000`).
+ * 
+ * `acc`, `b` and `c` must have been initialized (see bfp_complex_s32_init()), and must be the same
+ * length. `b` and `c` may be the same vector, in which case @vector{A} tracks the smoothed power 
+ * spectrum of @vector{B}.
+ * 
+ * @operation{
+ * &    A_k \leftarrow \alpha \cdot A_k + (1 - \alpha) \cdot B_k \cdot (C_k)^*          \\
+ * &        \qquad\text{for } k \in 0\ ...\ (N-1)                                       \\
+ * &        \qquad\text{where } N \text{ is the length of } \bar{B}\text{ and }\bar{C}  \\
+ * &        \qquad\text{and } (C_k)^* \text{ is the complex conjugate of } C_k
+ * }
+ * 
+ * @param[inout]  acc       Input/Output accumulator complex BFP vector @vector{A}
+ * @param[in]     b         Input complex BFP vector @vector{B}
+ * @param[in]     c         Input complex BFP vector @vector{C}
+ * @param[in]     alpha_q30 Smoothing coefficient @math{\alpha} in Q30 format
+ * 
+ * @see bfp_complex_s32_conj_macc_ema_pairs
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_conj_macc_ema(
+    bfp_complex_s32_t* acc, 
+    const bfp_complex_s32_t* b, 
+    const bfp_complex_s32_t* c,
+    const fixed_s32_t alpha_q30);
+
+
+/**
+ * @brief Update the smoothed cross-power spectra of every pair of channels with one frame.
+ * 
+ * `x[]` is an array of `channels` complex BFP vectors @math{\bar{X}_0 ... \bar{X}_{M-1}}, e.g. the 
+ * spectra of one frame from each of `M` microphones. `acc[]` is the array of smoothed cross-power 
+ * spectra @math{\bar{R}_{ij}} between them. 
+ * 
+ * Since @math{\bar{R}_{ji} = \bar{R}_{ij}^*}, only the upper triangle of the matrix (including the 
+ * diagonal) is stored and updated. `acc[]` must hold @math{M(M+1)/2} vectors, ordered by row. For 
+ * example, with 3 channels the order is @math{R_{00}, R_{01}, R_{02}, R_{11}, R_{12}, R_{22}}.
+ * 
+ * Each @math{\bar{R}_{ij}} is updated as though by 
+ * `bfp_complex_s32_conj_macc_ema(&acc[p], &x[i], &x[j], alpha_q30)`.
+ * 
+ * All vectors must have been initialized (see bfp_complex_s32_init()), and must be the same length.
+ * 
+ * @operation{
+ * &    R_{ij,k} \leftarrow \alpha \cdot R_{ij,k} + (1 - \alpha) \cdot X_{i,k} \cdot (X_{j,k})^* \\
+ * &        \qquad\text{for } 0 \le i \le j < M \text{ and } k \in 0\ ...\ (N-1) 
+ * }
+ * 
+ * @param[inout]  acc       Array of @math{M(M+1)/2} accumulator complex BFP vectors
+ * @param[in]     x         Array of @math{M} input complex BFP vectors
+ * @param[in]     channels  Number of channels @math{M}
+ * @param[in]     alpha_q30 Smoothing coefficient @math{\alpha} in Q30 format
+ * 
+ * @see bfp_complex_s32_conj_macc_ema
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_conj_macc_ema_pairs(
+    bfp_complex_s32_t acc[], 
+    const bfp_complex_s32_t x[],
+    const unsigned channels,
+    const fixed_s32_t alpha_q30);
+
+
+/**
+ * @brief Solve a batch of Hermitian positive definite linear systems, one per bin.
+ * 
+ * For each bin @math{f} this solves @math{R_f \cdot x_f = b_f}, where @math{R_f} is an
+ * @math{M \times M} Hermitian positive definite matrix and @math{b_f} is a vector of @math{M} 
+ * elements. A typical use is finding MVDR beamformer weights @math{R_f^{-1} d_f} in each frequency
+ * bin of a spatial covariance matrix, as produced by bfp_complex_s32_conj_macc_ema_pairs().
+ * 
+ * The data are stored bin-major: each BFP vector holds one matrix (or vector) element for every 
+ * bin. `R[]` is the upper triangle of the matrices in the layout used by 
+ * bfp_complex_s32_conj_macc_ema_pairs(), i.e. @math{M(M+1)/2} vectors ordered by row. `b[]` and
+ * `x[]` are each @math{M} vectors. All vectors must be the same length, which is the number of bins.
+ * 
+ * The solver uses an @math{LDL^H} (square-root-free Cholesky) factorization. Each step of the
+ * factorization and of the two triangular solves is an element-wise BFP operation over all bins at
+ * once. Before factorizing, each bin's matrix and right-hand side are scaled by their own power of
+ * 2, so the factorization keeps its precision in bins whose power is far below that of other bins.
+ * The output vectors are then scaled back. Like any BFP vector, each of them has a single exponent
+ * across all bins.
+ * 
+ * A bin whose matrix is singular or not positive definite, to within about @math{2^{-24}} of its 
+ * largest diagonal element, gets a zero solution. So does a bin whose right-hand side is zero. 
+ * Diagonal loading of @math{R} before calling this avoids the former.
+ * 
+ * `R[]` is used as workspace and its contents are undefined after this call. `x` may be the same 
+ * array of vectors as `b`.
+ * 
+ * `scratch[]` must hold at least `4 * length` words, where `length` is the number of bins, and
+ * must begin at a word-aligned address.
+ * 
+ * @operation{
+ * &    \bar{x}_f \leftarrow R_f^{-1} \cdot \bar{b}_f                                    \\
+ * &        \qquad\text{for } f \in 0\ ...\ (N-1)                                        \\
+ * &        \qquad\text{where } N \text{ is the number of bins}
+ * }
+ * 
+ * @param[out]    x         Array of @math{M} output complex BFP vectors
+ * @param[inout]  R         Array of @math{M(M+1)/2} complex BFP vectors (upper triangle of @math{R})
+ * @param[in]     b         Array of @math{M} input complex BFP vectors
+ * @param[in]     order     Order @math{M} of the matrices
+ * @param[in]     scratch   Scratch buffer of at least `4 * length` words
+ * 
+ * @see bfp_complex_s32_conj_macc_ema_pairs
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_hermitian_solve(
+    bfp_complex_s32_t x[],
+    bfp_complex_s32_t R[],
+    const bfp_complex_s32_t b[],
+    const unsigned order,
+    int32_t scratch[]);
@@ -232,8 +232,8 @@ void bfp_fft_inverse_complex(
  * Use of this function is not currently recommended. It functions correctly, but a recent
  * change in this library's API (namely, dropping support for channel-pair vectors) means this
  * function is no more computationally efficient than calling `bfp_fft_forward_mono()` on each input
- * vector separately. Additionally, this function currently requires a scratch buffer, whereas the
- * mono FFT does not. 
+ * vector separately. Additionally, unless the two channels' buffers are adjacent in memory (see
+ * below), this function requires a scratch buffer, whereas the mono FFT does not. 
  * @endparblock
  * 
  * Performs an @math{N}-point forward real DFT on the real 32-bit BFP vectors @vector{a} and
@@ -266,7 +266,10 @@ void bfp_fft_inverse_complex(
  * encoding of `b->data`.
  * 
  * This function requires a scratch buffer large enough to contain @math{N} `complex_s32_t`
- * elements.
+ * elements, unless `b->data` immediately follows `a->data` in memory (that is, 
+ * `b->data == &a->data[N]`). In that case the transform is computed in-place in the two channels' 
+ * buffers, and `scratch` may be `NULL`. Either way, the input samples are interleaved and placed in
+ * bit-reversed order in a single pass.
  * 
  * @par Example
  * @code
@@ -299,7 +302,8 @@ void bfp_fft_inverse_complex(
  *                          BFP vector @vector{A}
  * @param[inout]  b         [Input] Time-domain BFP vector @vector{b}. [Output] Frequency domain
  *                          BFP vector @vector{B}
- * @param         scratch   Scratch buffer of at least `a->length` `complex_s32_t` elements
+ * @param         scratch   Scratch buffer of at least `a->length` `complex_s32_t` elements, or 
+ *                          `NULL` if `b->data` immediately follows `a->data`
  * 
  * @deprecated
  * 
@@ -321,8 +325,8 @@ void bfp_fft_forward_stereo(
  * Use of this function is not currently recommended. It functions correctly, but a recent
  * change in this library's API (namely, dropping support for channel-pair vectors) means this
  * function is no more computationally efficient than calling `bfp_fft_forward_mono()` on each input
- * vector separately. Additionally, this function currently requires a scratch buffer, whereas the
- * mono FFT does not. 
+ * vector separately. Additionally, unless the two channels' buffers are adjacent in memory (see
+ * below), this function requires a scratch buffer, whereas the mono FFT does not. 
  * @endparblock
  * 
  * Performs an @math{N}-point inverse real DFT on the 32-bit complex BFP vectors @vector{A} and
@@ -353,7 +357,10 @@ void bfp_fft_forward_stereo(
  * A[N/2]}. Likewise for the encoding of `B_fft->data`.
  * 
  * This function requires a scratch buffer large enough to contain @math{2N} `complex_s32_t`
- * elements.
+ * elements, unless `B_fft->data` immediately follows `A_fft->data` in memory (that is, 
+ * `B_fft->data == &A_fft->data[N]`). In that case the transform is computed in-place in the two 
+ * channels' buffers, and `scratch` may be `NULL`. Either way, the output samples are taken out of 
+ * bit-reversed order and separated into the two channels in a single pass.
  * 
  * @par Example
  * @code
@@ -386,7 +393,8 @@ void bfp_fft_forward_stereo(
  *                          [Output] Time domain BFP vector @vector{b}
  * @param[inout]  B_fft     [Input] Freq-domain BFP vector @vector{b}. 
  *                          [Output] Time domain BFP vector @vector{b}
- * @param         scratch   Scratch buffer of at least `2*A_fft->length` `complex_s32_t` elements
+ * @param         scratch   Scratch buffer of at least `2*A_fft->length` `complex_s32_t` elements,
+ *                          or `NULL` if `B_fft->data` immediately follows `A_fft->data`
  * 
  * @deprecated
  * 
@@ -399,6 +407,78 @@ void  bfp_fft_inverse_stereo(
     bfp_complex_s32_t* B_fft,
     complex_s32_t scratch[]);
 
+
+/** 
+ * @brief Performs forward real Discrete Fourier Transforms on an array of real 32-bit sequences.
+ * 
+ * Performs an @math{N}-point forward real DFT on each of the `channel_count` real 32-bit BFP vectors in 
+ * `channels[]`. Pairs of channels are transformed together with a single @math{N}-point complex FFT (as with 
+ * bfp_fft_forward_stereo()), so @math{2K} channels take @math{K} complex FFTs. If `channel_count` is odd, the 
+ * final channel is transformed with bfp_fft_forward_mono().
+ * 
+ * All channels must have the same length @math{N}, which must be a power of 2 no larger than 
+ * `(1<<MAX_DIT_FFT_LOG2)`.
+ * 
+ * As with bfp_fft_forward_mono() and bfp_fft_forward_stereo(), the operation is performed in-place, and each element
+ * of `channels[]` should be cast to `bfp_complex_s32_t*` to access its spectrum afterwards. Each spectrum is an
+ * @math{N/2}-element complex BFP vector encoded as specified for real DFTs in @ref spectrum_packing, so the 
+ * spectra can be used interchangeably with those from bfp_fft_forward_mono(). The exponent of each spectrum is 
+ * independent, but the two spectra of each pair share the same headroom value (which is the smaller of the two).
+ * 
+ * `scratch` must have room for @math{N} `complex_s32_t` elements, unless the data of channel @math{2k+1} 
+ * immediately follows the data of channel @math{2k} in memory for every pair. In particular, if all channels'
+ * sample buffers are laid out back-to-back in a single array, `scratch` may be `NULL`.
+ * 
+ * @param[inout]  channels      [Input] Time-domain BFP vectors. [Output] Frequency-domain BFP vectors
+ * @param[in]     channel_count Number of channels
+ * @param         scratch       Scratch buffer of at least @math{N} `complex_s32_t` elements, or `NULL`
+ * 
+ * @see bfp_fft_inverse_multi,
+ *      bfp_fft_forward_stereo,
+ *      bfp_fft_forward_mono
+ * 
+ * @ingroup bfp_fft_func
+ */
+C_API
+void bfp_fft_forward_multi(
+    bfp_s32_t channels[],
+    const unsigned channel_count,
+    complex_s32_t scratch[]);
+
+
+/** 
+ * @brief Performs inverse real Discrete Fourier Transforms on an array of complex 32-bit spectra.
+ * 
+ * This is the inverse of bfp_fft_forward_multi(). Each of the `channel_count` complex BFP vectors in `spectra[]`,
+ * encoded as specified for real DFTs in @ref spectrum_packing, is inverse-transformed into a real BFP vector.
+ * Pairs of spectra are inverse-transformed together with a single complex IFFT (as with bfp_fft_inverse_stereo()). 
+ * If `channel_count` is odd, the final spectrum is inverse-transformed with bfp_fft_inverse_mono().
+ * 
+ * All spectra must have the same length @math{N/2}, where @math{N} is a power of 2 no larger than 
+ * `(1<<MAX_DIT_FFT_LOG2)`.
+ * 
+ * The operation is performed in-place, and each element of `spectra[]` should be cast to `bfp_s32_t*` to access its
+ * time-domain signal afterwards.
+ * 
+ * `scratch` must have room for @math{N} `complex_s32_t` elements, unless the data of spectrum @math{2k+1} 
+ * immediately follows the data of spectrum @math{2k} in memory for every pair, in which case it may be `NULL`.
+ * 
+ * @param[inout]  spectra       [Input] Frequency-domain BFP vectors. [Output] Time-domain BFP vectors
+ * @param[in]     channel_count Number of channels
+ * @param         scratch       Scratch buffer of at least @math{N} `complex_s32_t` elements, or `NULL`
+ * 
+ * @see bfp_fft_forward_multi,
+ *      bfp_fft_inverse_stereo,
+ *      bfp_fft_inverse_mono
+ * 
+ * @ingroup bfp_fft_func
+ */
+C_API
+void bfp_fft_inverse_multi(
+    bfp_complex_s32_t spectra[],
+    const unsigned channel_count,
+    complex_s32_t scratch[]);
+
 /**
  * @brief Unpack the spectrum resulting from bfp_fft_forward_mono().
  * 
@@ -453,4 +533,91 @@ void bfp_fft_unpack_mono(
  */
 C_API
 void bfp_fft_pack_mono(
-    bfp_complex_s32_t* x);
\ No newline at end of file
+    bfp_complex_s32_t* x);
+
+/**
+ * @brief Compute the analytic signal of a real 32-bit BFP vector (Hilbert transform).
+ * 
+ * The analytic signal @vector{A} of real input BFP vector @vector{b} is computed and placed in
+ * complex BFP vector `a`. The real part of @vector{A} is (up to arithmetic error) the input
+ * signal @vector{b} itself, and the imaginary part is the Hilbert transform of @vector{b}.
+ * 
+ * The analytic signal is computed in the frequency domain. A forward real DFT of @vector{b} is
+ * computed (as with bfp_fft_forward_mono()), the positive-frequency bins are doubled and the
+ * negative-frequency bins are zeroed, and then an inverse complex DFT is applied. The DC and
+ * Nyquist bins are modified directly in the packed real-DFT representation (see @ref
+ * spectrum_packing), so neither bfp_fft_unpack_mono() nor bfp_fft_pack_mono() is needed. The cost
+ * is approximately that of one @math{N}-point real FFT plus one @math{N}-point complex IFFT.
+ * 
+ * @operation{
+ * &     B_f \leftarrow \sum_{n=0}^{N-1} \left( b_n \cdot e^{-j2\pi fn/N} \right)      \\
+ * &     Z_f \leftarrow \begin{cases}
+ * &         B_f       &   f = 0 \text{ or } f = N/2           \\
+ * &         2 B_f     &   0 \lt f \lt N/2                     \\
+ * &         0         &   N/2 \lt f \lt N
+ * &     \end{cases}                                                                    \\
+ * &     A_n \leftarrow \frac{1}{N} \sum_{f=0}^{N-1} \left( Z_f \cdot e^{j2\pi fn/N} \right)  \\
+ * &         \qquad\text{for } n \in 0\ ...\ (N-1)                                     \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{b}
+ * }
+ * 
+ * `b->length` (@math{N}) must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
+ * 
+ * `a->data` must point to a buffer with space for at least @math{N} `complex_s32_t` elements. The
+ * exponent, headroom and length of `a` are updated by this function. Upon completion `a->length`
+ * is @math{N}.
+ * 
+ * `b` is not modified. This operation may be performed in-place by having `b->data` point to the
+ * start of `a->data`, in which case the input samples are overwritten.
+ * 
+ * @param[out]  a   Output complex BFP vector @vector{A} (analytic signal)
+ * @param[in]   b   Input real BFP vector @vector{b}
+ * 
+ * @see bfp_fft_forward_mono,
+ *      bfp_fft_inverse_complex,
+ *      bfp_s32_envelope
+ * 
+ * @ingroup bfp_fft_func
+ */
+C_API
+void bfp_s32_hilbert(
+    bfp_complex_s32_t* a,
+    const bfp_s32_t* b);
+
+
+/**
+ * @brief Compute the amplitude envelope of a real 32-bit BFP vector.
+ * 
+ * The amplitude envelope @vector{A} of real input BFP vector @vector{B} is computed as the
+ * magnitude of its analytic signal (see bfp_s32_hilbert()). The analytic signal is computed in
+ * `scratch[]`, and its element-wise magnitude is written directly to `a`.
+ * 
+ * @operation{
+ * &     Z \leftarrow \text{analytic signal of } \bar{B}  \text{ (see bfp\_s32\_hilbert())}  \\
+ * &     A_k \leftarrow \left| Z_k \right|                                                    \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                                          \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * `b->length` (@math{N}) must be a power of 2, and must be no larger than `(1<<MAX_DIT_FFT_LOG2)`.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * `scratch[]` must have space for at least @math{N} `complex_s32_t` elements, and must be
+ * double word-aligned.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @param[out]  a         Output BFP vector @vector{A}
+ * @param[in]   b         Input BFP vector @vector{B}
+ * @param       scratch   Scratch buffer of at least `b->length` `complex_s32_t` elements
+ * 
+ * @see bfp_s32_hilbert
+ * 
+ * @ingroup bfp_fft_func
+ */
+C_API
+void bfp_s32_envelope(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    complex_s32_t scratch[]);
@@ -159,6 +159,39 @@ void bfp_complex_s32_init(
     const unsigned length,
     const unsigned calc_hr);
 
+/** 
+ * @brief Initialize a planar complex 32-bit BFP vector.
+ * 
+ * This function initializes each of the fields of `a`.
+ * 
+ * Like `bfp_complex_s16_t`, planar complex 32-bit BFP vectors store the real and imaginary parts of
+ * the mantissas in separate buffers. `real_data` and `imag_data` must each be at least `length * 4`
+ * bytes long, and must begin at a word-aligned address.
+ * 
+ * `exp` is the exponent assigned to the BFP vector. The logical value associated with the `k`th complex
+ * element of the vector after initialization will be @f$ \left(real_k + i\cdot imag_k \right)\cdot2^{exp} @f$.
+ * 
+ * If `calc_hr` is false, `a->hr` is initialized to 0. Otherwise, the headroom of the the BFP vector 
+ * is calculated and used to initialize `a->hr`.
+ * 
+ * @param[out] a         BFP vector struct to initialize
+ * @param[in]  real_data `int32_t` buffer used to back the real part of `a`
+ * @param[in]  imag_data `int32_t` buffer used to back the imaginary part of `a`
+ * @param[in]  exp       Exponent of BFP vector
+ * @param[in]  length    Number of elements in BFP vector
+ * @param[in]  calc_hr   Boolean indicating whether the HR of the BFP vector should be calculated
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_complex_s32_planar_init(
+    bfp_complex_s32_planar_t* a, 
+    int32_t* real_data,
+    int32_t* imag_data, 
+    const exponent_t exp, 
+    const unsigned length,
+    const unsigned calc_hr);
+
 
 /**
  * @brief Dynamically allocate a 32-bit BFP vector from the heap.
@@ -27,4 +27,776 @@ C_API
 void bfp_complex_s32_gradient_constraint_stereo(
     bfp_complex_s32_t* X1,
     bfp_complex_s32_t* X2,
-    const unsigned frame_advance);
\ No newline at end of file
+    const unsigned frame_advance);
+
+
+/**
+ * @brief Minimum-statistics noise floor tracker.
+ * 
+ * Tracks the per-bin minimum of a sequence of (smoothed) power spectra over a sliding window of
+ * frames, as used by minimum-statistics and MCRA noise estimators.
+ * 
+ * Rather than keeping a history of every frame in the window, the window of 
+ * `subwin_count * subwin_frames` frames is divided into `subwin_count` sub-windows of 
+ * `subwin_frames` frames each, and only the per-bin minimum of each sub-window is stored. Each 
+ * frame, the running minimum of the current sub-window is updated, and the noise floor estimate is
+ * the minimum of that and the minimum over all completed sub-windows. The minimum over the 
+ * completed sub-windows is only recomputed when a sub-window is completed.
+ * 
+ * The effective window length is between `(subwin_count - 1) * subwin_frames` and 
+ * `subwin_count * subwin_frames` frames.
+ * 
+ * The estimate produced is the raw minimum. Any bias compensation (or speech presence 
+ * probability computation, for MCRA) is left to the user.
+ * 
+ * Initialize with bfp_min_stats_s32_init() and update once per frame with 
+ * bfp_min_stats_s32_update(). The fields of this struct are considered to be opaque.
+ * 
+ * @see bfp_min_stats_s32_init,
+ *      bfp_min_stats_s32_update
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** Number of sub-windows. */
+    unsigned subwin_count;
+    /** Number of frames per sub-window. */
+    unsigned subwin_frames;
+    /** Number of frames so far in the current sub-window. */
+    unsigned frame;
+    /** Index of the current sub-window in `subwin_min`. */
+    unsigned head;
+    /** Number of completed sub-windows (at most `subwin_count - 1`). */
+    unsigned filled;
+    /** Per-bin minima of each sub-window, as a circular buffer. */
+    bfp_s32_t* subwin_min;
+    /** Per-bin minima over the completed sub-windows. */
+    bfp_s32_t window_min;
+} bfp_min_stats_s32_t;
+
+
+/**
+ * @brief Number of `int32_t` words of buffer required by a bfp_min_stats_s32_t.
+ * 
+ * @param BINS          Number of bins in each power spectrum
+ * @param SUBWIN_COUNT  Number of sub-windows
+ * 
+ * @see bfp_min_stats_s32_init
+ */
+#define BFP_MIN_STATS_S32_BUFFER_SIZE(BINS, SUBWIN_COUNT)     (((SUBWIN_COUNT) + 1) * (BINS))
+
+
+/**
+ * @brief Initialize a minimum-statistics noise floor tracker.
+ * 
+ * `subwin_min[]` is an array of `subwin_count` BFP vectors used by the tracker for the minimum of
+ * each sub-window. These are initialized by this function.
+ * 
+ * `buffer[]` is the memory backing the tracker's state. It must be at least 
+ * `BFP_MIN_STATS_S32_BUFFER_SIZE(bins, subwin_count)` words long and word-aligned.
+ * 
+ * `bins` is the number of elements in each power spectrum given to the tracker.
+ * 
+ * `subwin_count` is the number of sub-windows @math{U}, and must be at least @math{2}.
+ * 
+ * `subwin_frames` is the number of frames @math{V} in each sub-window.
+ * 
+ * @param[out]  tracker         Tracker to be initialized
+ * @param[out]  subwin_min      Array of `subwin_count` BFP vectors used by the tracker
+ * @param[in]   buffer          Buffer backing the tracker's state
+ * @param[in]   bins            Number of bins per frame
+ * @param[in]   subwin_count    Number of sub-windows @math{U}
+ * @param[in]   subwin_frames   Number of frames per sub-window @math{V}
+ * 
+ * @see bfp_min_stats_s32_t,
+ *      bfp_min_stats_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_min_stats_s32_init(
+    bfp_min_stats_s32_t* tracker,
+    bfp_s32_t subwin_min[],
+    int32_t buffer[],
+    const unsigned bins,
+    const unsigned subwin_count,
+    const unsigned subwin_frames);
+
+
+/**
+ * @brief Update a minimum-statistics noise floor tracker with a new frame.
+ * 
+ * The running minimum of the tracker's current sub-window is updated with the new power spectrum
+ * @vector{P}, and the per-bin minimum over the whole tracking window is written to output BFP 
+ * vector @vector{A}. 
+ * 
+ * Each call costs two element-wise passes over the bins. Once every @math{V} frames, when a 
+ * sub-window is completed, a further @math{U-2} passes are used to recompute the minimum over the
+ * completed sub-windows.
+ * 
+ * Power spectrum elements are expected to be non-negative.
+ * 
+ * `noise_floor` and `power` must have been initialized and must be the same length as the 
+ * tracker's bins. This operation can be performed safely in-place on `power`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow min\left\\{ P_k[t-i] \right\\}_{i=0}^{W-1}                     \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                                  \\
+ * &         \qquad\text{where } N \text{ is the number of bins, and } W \text{ is the current window length}
+ * }
+ * 
+ * @param[out]      noise_floor     Output noise floor estimate @vector{A}
+ * @param[inout]    tracker         Noise floor tracker
+ * @param[in]       power           Power spectrum @vector{P} of the new frame
+ * 
+ * @see bfp_min_stats_s32_t,
+ *      bfp_min_stats_s32_init
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_min_stats_s32_update(
+    bfp_s32_t* noise_floor,
+    bfp_min_stats_s32_t* tracker,
+    const bfp_s32_t* power);
+
+
+/**
+ * @brief Per-channel state of a bfp_meter_s32_t.
+ * 
+ * @see bfp_meter_s32_t
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** Current (held or decaying) peak level. */
+    float_s32_t peak;
+    /** Smoothed mean-square level. */
+    float_s32_t mean_square;
+    /** Number of frames remaining before the peak level begins to decay. */
+    unsigned hold;
+} bfp_meter_s32_channel_t;
+
+
+/**
+ * @brief Multichannel peak-hold and RMS level meter.
+ * 
+ * Tracks the peak level and RMS level of each of a bank of channels, updated once per frame.
+ * 
+ * The peak level of a channel is the largest absolute sample value seen. When a new peak is
+ * reached it is held for `hold_frames` frames, after which it decays by a factor of `peak_decay`
+ * per frame until exceeded by a new peak.
+ * 
+ * The RMS level of a channel is the square root of an exponential moving average of the mean 
+ * square of each frame, with smoothing coefficient `rms_coef`.
+ * 
+ * Each frame, the absolute maximum and the energy of each channel are found together in a single
+ * pass using xs3_vect_s32_abs_max_energy(). The state of each channel is kept as @ref float_s32_t
+ * values, so channels with very different levels can share the bank without loss of precision.
+ * 
+ * Initialize with bfp_meter_s32_init(), update once per frame with bfp_meter_s32_update() and
+ * read the levels with bfp_meter_s32_peak() and bfp_meter_s32_rms().
+ * 
+ * @see bfp_meter_s32_init,
+ *      bfp_meter_s32_update,
+ *      bfp_meter_s32_peak,
+ *      bfp_meter_s32_rms
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** Number of channels. */
+    unsigned channels;
+    /** Number of samples per channel per frame. */
+    unsigned frame_length;
+    /** Number of frames for which a new peak is held. */
+    unsigned hold_frames;
+    /** Per-frame peak decay factor (Q2.30). */
+    fixed_s32_t peak_decay;
+    /** EMA coefficient applied to the previous mean-square level (Q2.30). */
+    fixed_s32_t rms_coef;
+    /** The reciprocal of `frame_length`. */
+    float_s32_t frame_length_inv;
+    /** Per-channel state. */
+    bfp_meter_s32_channel_t* state;
+} bfp_meter_s32_t;
+
+
+/**
+ * @brief Initialize a multichannel peak-hold and RMS level meter.
+ * 
+ * `state[]` is an array of `channels` elements used by the meter for the state of each channel.
+ * All levels are initially zero.
+ * 
+ * `frame_length` is the number of samples per channel in each frame given to bfp_meter_s32_update().
+ * 
+ * `hold_frames` is the number of frames for which a new peak level is held before it begins to
+ * decay.
+ * 
+ * `peak_decay` is the Q2.30 factor @math{d} by which the peak level is multiplied each frame once
+ * the hold has expired. It should be in the range @math{[0, 2^{30}]}.
+ * 
+ * `rms_coef` is the Q2.30 EMA coefficient @math{\alpha} applied to the previous mean-square level.
+ * It should be in the range @math{[0, 2^{30}]}.
+ * 
+ * @param[out]  meter           Meter to be initialized
+ * @param[out]  state           Array of `channels` per-channel states
+ * @param[in]   channels        Number of channels
+ * @param[in]   frame_length    Number of samples per channel per frame
+ * @param[in]   hold_frames     Number of frames for which a peak is held
+ * @param[in]   peak_decay      Per-frame peak decay factor @math{d} (Q2.30)
+ * @param[in]   rms_coef        Mean-square EMA coefficient @math{\alpha} (Q2.30)
+ * 
+ * @see bfp_meter_s32_t,
+ *      bfp_meter_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_meter_s32_init(
+    bfp_meter_s32_t* meter,
+    bfp_meter_s32_channel_t state[],
+    const unsigned channels,
+    const unsigned frame_length,
+    const unsigned hold_frames,
+    const fixed_s32_t peak_decay,
+    const fixed_s32_t rms_coef);
+
+
+/**
+ * @brief Update a multichannel peak-hold and RMS level meter with a new frame.
+ * 
+ * `frame[]` is an array of the meter's `channels` BFP vectors, one per channel, each of which 
+ * must have the meter's `frame_length` elements.
+ * 
+ * Each channel is read exactly once.
+ * 
+ * @operation{
+ * &     p_c \leftarrow max\\{ \left| X_c[k] \right| \\}_{k=0}^{N-1}                       \\
+ * &     P_c \leftarrow \begin{cases}
+ *          p_c                 & p_c \geq P_c' \\
+ *          P_c'                & otherwise \end{cases}                                   \\
+ * &     \qquad\text{where } P_c' = P_c \text{ during the hold, and } d \cdot P_c \text{ after it}   \\
+ * &     M_c \leftarrow \alpha \cdot M_c + (1 - \alpha) \cdot \frac{1}{N}\sum_{k=0}^{N-1} X_c[k]^2   \\
+ * &         \qquad\text{for } c \in 0\ ...\ (C-1)                                        \\
+ * &         \qquad\text{where } C \text{ is the number of channels and } N \text{ is the frame length}
+ * }
+ * 
+ * @param[inout]    meter   Meter to be updated
+ * @param[in]       frame   Array of one BFP vector @vector{X_c} per channel
+ * 
+ * @see bfp_meter_s32_t,
+ *      bfp_meter_s32_peak,
+ *      bfp_meter_s32_rms
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_meter_s32_update(
+    bfp_meter_s32_t* meter,
+    const bfp_s32_t frame[]);
+
+
+/**
+ * @brief Get the current peak level of one channel of a level meter.
+ * 
+ * @param[in]   meter       Level meter
+ * @param[in]   channel     Index of the channel
+ * 
+ * @returns     The channel's current peak level @math{P_c}
+ * 
+ * @see bfp_meter_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_meter_s32_peak(
+    const bfp_meter_s32_t* meter,
+    const unsigned channel);
+
+
+/**
+ * @brief Get the current RMS level of one channel of a level meter.
+ * 
+ * The square root is only computed here, not on every update.
+ * 
+ * @param[in]   meter       Level meter
+ * @param[in]   channel     Index of the channel
+ * 
+ * @returns     The channel's current RMS level @math{\sqrt{M_c}}
+ * 
+ * @see bfp_meter_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_meter_s32_rms(
+    const bfp_meter_s32_t* meter,
+    const unsigned channel);
+
+
+/**
+ * @brief Running cepstral mean and variance normalization (CMVN) state.
+ * 
+ * Normalizes a stream of feature vectors (e.g. one vector of cepstral coefficients per frame) so
+ * that each dimension has approximately zero mean and unit variance.
+ * 
+ * The mean and the variance of each dimension are tracked as exponential moving averages with 
+ * smoothing coefficient `alpha`. The variance is updated from the deviation of each new feature 
+ * vector from the mean (an exponentially weighted form of Welford's algorithm), so it remains
+ * accurate when a dimension's mean is large compared to its spread. `var_floor` is added to the
+ * variance before it is used, to avoid dividing by (near) zero in dimensions with little or no 
+ * variation.
+ * 
+ * Initialize with bfp_cmvn_s32_init() and then call bfp_cmvn_s32_update() once per feature
+ * vector.
+ * 
+ * @see bfp_cmvn_s32_init,
+ *      bfp_cmvn_s32_update
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** EMA coefficient applied to the previous mean and variance (Q2.30). */
+    fixed_s32_t alpha;
+    /** Value added to each variance estimate. */
+    float_s32_t var_floor;
+    /** Non-zero once the first feature vector has been seen. */
+    unsigned frames;
+    /** Per-dimension running mean. */
+    bfp_s32_t mean;
+    /** Per-dimension running variance. */
+    bfp_s32_t var;
+    /** Per-dimension working space. */
+    bfp_s32_t scratch;
+} bfp_cmvn_s32_t;
+
+
+/**
+ * @brief Number of `int32_t` words of buffer required by a bfp_cmvn_s32_t.
+ * 
+ * @param DIMS  Number of dimensions in each feature vector
+ * 
+ * @see bfp_cmvn_s32_init
+ */
+#define BFP_CMVN_S32_BUFFER_SIZE(DIMS)     (3 * (DIMS))
+
+
+/**
+ * @brief Initialize a running CMVN state.
+ * 
+ * `buffer[]` is the memory backing the state. It must be at least `BFP_CMVN_S32_BUFFER_SIZE(dims)` 
+ * words long and word-aligned.
+ * 
+ * `dims` is the number of elements in each feature vector given to bfp_cmvn_s32_update().
+ * 
+ * `alpha` is the Q2.30 EMA coefficient @math{\alpha} applied to the previous mean and variance. It
+ * should be in the range @math{[0, 2^{30}]}. Larger values give slower adaptation.
+ * 
+ * `var_floor` is the value @math{\epsilon} added to each variance estimate. It must be positive.
+ * 
+ * @param[out]  cmvn        CMVN state to be initialized
+ * @param[in]   buffer      Buffer backing the state
+ * @param[in]   dims        Number of dimensions in each feature vector
+ * @param[in]   alpha       EMA coefficient @math{\alpha} (Q2.30)
+ * @param[in]   var_floor   Variance floor @math{\epsilon}
+ * 
+ * @see bfp_cmvn_s32_t,
+ *      bfp_cmvn_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_cmvn_s32_init(
+    bfp_cmvn_s32_t* cmvn,
+    int32_t buffer[],
+    const unsigned dims,
+    const fixed_s32_t alpha,
+    const float_s32_t var_floor);
+
+
+/**
+ * @brief Update a running CMVN state with a new feature vector and normalize it.
+ * 
+ * The running mean @vector{M} and variance @vector{V} are updated with feature vector @vector{X}, and 
+ * @vector{X} normalized with the updated statistics is output to @vector{A}. The first feature vector
+ * seen replaces the (empty) initial statistics, rather than being averaged with them, so the first
+ * output is zero.
+ * 
+ * Each of the mean and variance updates is a single one-pole smoother pass (see bfp_s32_smooth()).
+ * 
+ * `a` and `x` must both have the number of elements the state was initialized with.
+ * 
+ * This operation can be performed safely in-place on `x`.
+ * 
+ * @operation{
+ * &     \Delta_k \leftarrow X_k - M_k                                                    \\
+ * &     M_k \leftarrow M_k + (1 - \alpha) \cdot \Delta_k                                 \\
+ * &     V_k \leftarrow \alpha \cdot \left(V_k + (1 - \alpha) \cdot \Delta_k^2\right)     \\
+ * &     A_k \leftarrow \frac{X_k - M_k}{\sqrt{V_k + \epsilon}}                            \\
+ * &         \qquad\text{for } k \in 0\ ...\ (D-1)                                        \\
+ * &         \qquad\text{where } D \text{ is the number of dimensions}
+ * }
+ * 
+ * @param[out]      a       Output normalized feature vector @vector{A}
+ * @param[inout]    cmvn    CMVN state
+ * @param[in]       x       Input feature vector @vector{X}
+ * 
+ * @see bfp_cmvn_s32_t,
+ *      bfp_cmvn_s32_init
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_cmvn_s32_update(
+    bfp_s32_t* a,
+    bfp_cmvn_s32_t* cmvn,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Sliding-window statistics of a stream of samples.
+ * 
+ * Tracks the sum, mean, energy, maximum and minimum of the most recent `window` samples of a 
+ * stream, which may be supplied in blocks of any length.
+ * 
+ * Samples are held at a fixed exponent chosen when the object is initialized. The running sum and
+ * energy are updated in @math{O(1)} per sample by adding the incoming sample's contribution and 
+ * subtracting that of the sample leaving the window. Both are kept as exact 64-bit integers (each 
+ * sample's squared contribution is computed identically when it enters and when it leaves), so 
+ * they cannot drift however long the stream runs, and no periodic recomputation is needed.
+ * 
+ * The maximum and minimum are tracked with monotonic deques of positions in the window's history,
+ * so each sample is pushed and popped at most once from each deque, for amortized @math{O(1)} cost
+ * per sample.
+ * 
+ * Initialize with bfp_window_s32_init(), add samples with bfp_window_s32_push() and read the 
+ * statistics with bfp_window_s32_sum(), bfp_window_s32_mean(), bfp_window_s32_energy(), 
+ * bfp_window_s32_max() and bfp_window_s32_min().
+ * 
+ * @see bfp_window_s32_init,
+ *      bfp_window_s32_push
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** Window length, in samples. */
+    unsigned window;
+    /** Number of samples currently in the window (at most `window`). */
+    unsigned filled;
+    /** Position in `history` at which the next sample will be written. */
+    unsigned head;
+    /** Exponent associated with the samples in `history`. */
+    exponent_t exp;
+    /** Right-shift applied to each squared sample before it is accumulated in `energy`. */
+    right_shift_t energy_shr;
+    /** Sum of the samples in the window. */
+    int64_t sum;
+    /** Sum of the (shifted) squares of the samples in the window. */
+    int64_t energy;
+    /** Circular buffer of the most recent `window` samples. */
+    int32_t* history;
+    /** Circular buffer of positions in `history` whose values decrease from front to back. */
+    unsigned* max_deque;
+    /** Circular buffer of positions in `history` whose values increase from front to back. */
+    unsigned* min_deque;
+    /** Index of the front of `max_deque`. */
+    unsigned max_front;
+    /** Number of entries in `max_deque`. */
+    unsigned max_count;
+    /** Index of the front of `min_deque`. */
+    unsigned min_front;
+    /** Number of entries in `min_deque`. */
+    unsigned min_count;
+} bfp_window_s32_t;
+
+
+/**
+ * @brief Number of `int32_t` words of buffer required by a bfp_window_s32_t.
+ * 
+ * @param WINDOW    Window length, in samples
+ * 
+ * @see bfp_window_s32_init
+ */
+#define BFP_WINDOW_S32_BUFFER_SIZE(WINDOW)     (3 * (WINDOW))
+
+
+/**
+ * @brief Initialize a sliding-window statistics object.
+ * 
+ * `buffer[]` is the memory backing the object. It must be at least 
+ * `BFP_WINDOW_S32_BUFFER_SIZE(window)` words long and word-aligned.
+ * 
+ * `window` is the number of most recent samples over which statistics are computed. It must be 
+ * non-zero.
+ * 
+ * `exp` is the exponent at which samples are held. Samples given to bfp_window_s32_push() are 
+ * shifted to this exponent, saturating if necessary, so it should be chosen to suit the largest
+ * expected sample magnitude (e.g. `-31` for samples in the range @math{[-1, 1)}).
+ * 
+ * @param[out]  win         Object to be initialized
+ * @param[in]   buffer      Buffer backing the object
+ * @param[in]   window      Window length @math{W}, in samples
+ * @param[in]   exp         Exponent at which samples are held
+ * 
+ * @see bfp_window_s32_t,
+ *      bfp_window_s32_push
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_window_s32_init(
+    bfp_window_s32_t* win,
+    int32_t buffer[],
+    const unsigned window,
+    const exponent_t exp);
+
+
+/**
+ * @brief Add a block of samples to a sliding-window statistics object.
+ * 
+ * The elements of BFP vector @vector{X} are added to the window in order, each displacing the 
+ * oldest sample once the window is full. @vector{X} may have any length, including more than the
+ * window length.
+ * 
+ * @param[inout]    win     Sliding-window statistics object
+ * @param[in]       x       Block of new samples @vector{X}
+ * 
+ * @see bfp_window_s32_t
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_window_s32_push(
+    bfp_window_s32_t* win,
+    const bfp_s32_t* x);
+
+
+/**
+ * @brief Get the sum of the samples in a sliding window.
+ * 
+ * @param[in]   win     Sliding-window statistics object
+ * 
+ * @returns     The sum of the samples currently in the window
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s64_t bfp_window_s32_sum(
+    const bfp_window_s32_t* win);
+
+
+/**
+ * @brief Get the mean of the samples in a sliding window.
+ * 
+ * Until the window has been filled, this is the mean of the samples pushed so far. At least one
+ * sample must have been pushed.
+ * 
+ * @param[in]   win     Sliding-window statistics object
+ * 
+ * @returns     The mean of the samples currently in the window
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_window_s32_mean(
+    const bfp_window_s32_t* win);
+
+
+/**
+ * @brief Get the energy (sum of squares) of the samples in a sliding window.
+ * 
+ * @param[in]   win     Sliding-window statistics object
+ * 
+ * @returns     The sum of the squares of the samples currently in the window
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s64_t bfp_window_s32_energy(
+    const bfp_window_s32_t* win);
+
+
+/**
+ * @brief Get the maximum of the samples in a sliding window.
+ * 
+ * At least one sample must have been pushed.
+ * 
+ * @param[in]   win     Sliding-window statistics object
+ * 
+ * @returns     The largest sample currently in the window
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_window_s32_max(
+    const bfp_window_s32_t* win);
+
+
+/**
+ * @brief Get the minimum of the samples in a sliding window.
+ * 
+ * At least one sample must have been pushed.
+ * 
+ * @param[in]   win     Sliding-window statistics object
+ * 
+ * @returns     The smallest sample currently in the window
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_window_s32_min(
+    const bfp_window_s32_t* win);
+
+
+/**
+ * @brief Block-based dynamic range compressor, limiter and automatic gain control (AGC).
+ * 
+ * Applies a time-varying gain to a stream of frames according to a static gain curve and 
+ * attack/release smoothing. Depending on its parameters, it acts as a compressor, a limiter, an 
+ * AGC, or a combination of these.
+ * 
+ * The level of each frame is its peak absolute value, found with vectorized max/min passes. Gains 
+ * are computed and smoothed in the log (base 2) domain once per frame rather than once per sample. 
+ * With @math{L} the level and @math{T} the threshold (both as base-2 logarithms), the gain curve is
+ * 
+ * @math{g(L) = min\left( (T - L) \cdot s, G \right)}, where @math{s} is `slope_above` if 
+ * @math{L > T} and `slope_below` otherwise, and @math{G} is the maximum gain.
+ * 
+ * - A compressor with ratio @math{R} has `slope_above` @math{= 1 - 1/R} and `slope_below` @math{= 0}.
+ * - A limiter has `slope_above` @math{= 1} and `slope_below` @math{= 0}.
+ * - An AGC has `slope_above` @math{= 1} and `slope_below` @math{= 1}, with @math{G > 1} limiting the
+ *   boost applied to quiet signals.
+ * 
+ * Output is delayed by one frame. This look-ahead lets the gain applied to each frame account for
+ * the frame after it, so that (with instant attack) gain reductions are complete before the peak
+ * which caused them reaches the output. Within each output frame the (linear) gain is ramped 
+ * from its previous value to its new one, and is applied with xs3_vect_s32_mul(). Because both 
+ * ends of the ramp are no greater than the gain required by that frame, a limiter with instant 
+ * attack never lets output exceed its threshold.
+ * 
+ * Each channel of a multichannel stream uses its own object.
+ * 
+ * Initialize with bfp_compressor_s32_init() and process frames with bfp_compressor_s32_update().
+ * 
+ * @see bfp_compressor_s32_init,
+ *      bfp_compressor_s32_update
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    /** Number of samples per frame. */
+    unsigned frame_length;
+    /** Threshold @math{T}, as a base-2 logarithm (Q8.24). */
+    int32_t threshold;
+    /** Slope of the gain curve above the threshold (Q2.30). */
+    fixed_s32_t slope_above;
+    /** Slope of the gain curve below the threshold (Q2.30). */
+    fixed_s32_t slope_below;
+    /** Maximum gain @math{G}, as a base-2 logarithm (Q8.24). */
+    int32_t max_gain;
+    /** Smoothing coefficient applied to the previous gain when the gain is falling (Q2.30). */
+    fixed_s32_t attack;
+    /** Smoothing coefficient applied to the previous gain when the gain is rising (Q2.30). */
+    fixed_s32_t release;
+    /** Gain required by the frame in the look-ahead delay, as a base-2 logarithm (Q8.24). */
+    int32_t required;
+    /** Smoothed gain at the end of the most recent output frame, as a base-2 logarithm (Q8.24). */
+    int32_t gain;
+    /** Index of the frame in `delay` holding the look-ahead frame. */
+    unsigned current;
+    /** Look-ahead frame, and space for the next input frame. */
+    bfp_s32_t delay[2];
+    /** Per-sample linear gain applied to the output frame. */
+    bfp_s32_t ramp;
+} bfp_compressor_s32_t;
+
+
+/**
+ * @brief Number of `int32_t` words of buffer required by a bfp_compressor_s32_t.
+ * 
+ * @param FRAME_LENGTH  Number of samples per frame
+ * 
+ * @see bfp_compressor_s32_init
+ */
+#define BFP_COMPRESSOR_S32_BUFFER_SIZE(FRAME_LENGTH)     (3 * (FRAME_LENGTH))
+
+
+/**
+ * @brief Initialize a compressor/limiter/AGC.
+ * 
+ * `buffer[]` is the memory backing the object. It must be at least 
+ * `BFP_COMPRESSOR_S32_BUFFER_SIZE(frame_length)` words long and word-aligned.
+ * 
+ * `frame_length` is the number of samples in each frame given to bfp_compressor_s32_update().
+ * 
+ * `threshold` is the (linear) threshold level @math{T}, and `max_gain` the (linear) maximum gain 
+ * @math{G}. Both must be positive.
+ * 
+ * `slope_above` and `slope_below` are the Q2.30 slopes of the gain curve (see bfp_compressor_s32_t).
+ * They should be in the range @math{[0, 2^{30}]}.
+ * 
+ * `attack` and `release` are the Q2.30 per-frame smoothing coefficients applied to the previous 
+ * gain when it is falling and rising respectively. `0` gives an instant change, and values closer 
+ * to @math{2^{30}} give slower changes.
+ * 
+ * The look-ahead frame is initially silent and the initial gain is unity (before any smoothing).
+ * 
+ * @param[out]  comp            Object to be initialized
+ * @param[in]   buffer          Buffer backing the object
+ * @param[in]   frame_length    Number of samples per frame
+ * @param[in]   threshold       Threshold level @math{T}
+ * @param[in]   slope_above     Gain curve slope above the threshold (Q2.30)
+ * @param[in]   slope_below     Gain curve slope below the threshold (Q2.30)
+ * @param[in]   max_gain        Maximum gain @math{G}
+ * @param[in]   attack          Attack smoothing coefficient (Q2.30)
+ * @param[in]   release         Release smoothing coefficient (Q2.30)
+ * 
+ * @see bfp_compressor_s32_t,
+ *      bfp_compressor_s32_update
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_compressor_s32_init(
+    bfp_compressor_s32_t* comp,
+    int32_t buffer[],
+    const unsigned frame_length,
+    const float_s32_t threshold,
+    const fixed_s32_t slope_above,
+    const fixed_s32_t slope_below,
+    const float_s32_t max_gain,
+    const fixed_s32_t attack,
+    const fixed_s32_t release);
+
+
+/**
+ * @brief Process a frame with a compressor/limiter/AGC.
+ * 
+ * Input frame @vector{X} enters the look-ahead delay, and the frame which it displaces is output to
+ * @vector{A} with the gain applied, so @vector{A} is delayed by one frame relative to @vector{X}.
+ * 
+ * `a` and `x` must both have the number of elements the object was initialized with.
+ * 
+ * This operation can be performed safely in-place on `x`.
+ * 
+ * @param[out]      a       Output frame @vector{A}
+ * @param[inout]    comp    Compressor/limiter/AGC
+ * @param[in]       x       Input frame @vector{X}
+ * 
+ * @see bfp_compressor_s32_t,
+ *      bfp_compressor_s32_init
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_compressor_s32_update(
+    bfp_s32_t* a,
+    bfp_compressor_s32_t* comp,
+    const bfp_s32_t* x);
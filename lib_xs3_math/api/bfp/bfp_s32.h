@@ -909,4 +909,669 @@ void bfp_s32_convolve_same(
   const bfp_s32_t* x,
   const int32_t b_q30[],
   const unsigned b_length,
-  const pad_mode_e padding_mode);
\ No newline at end of file
+  const pad_mode_e padding_mode);
+
+/**
+ * @brief Compute a Wiener noise-suppression gain vector from signal and noise power estimates.
+ * 
+ * Each element @math{A_k} of output BFP vector @vector{A} is set to the Wiener gain computed from
+ * the corresponding elements @math{S_k} and @math{N_k} of the (noisy) signal power BFP vector
+ * @vector{S} and the noise power BFP vector @vector{N}, using the maximum-likelihood a priori SNR
+ * estimate. Gains are clamped from below at @math{g_{min}}.
+ * 
+ * The gain is computed in a single pass over the inputs, in place of the separate inverse,
+ * multiply, subtract and clip operations otherwise required.
+ * 
+ * The output gains are always given in a Q2.30 format, i.e. upon completion `a->exp` is 
+ * @math{-30}, and all output mantissas lie in the range @math{[gain\_min, 2^{30}]}. The output
+ * vector can be applied directly to a spectrum using bfp_complex_s32_apply_gain().
+ * 
+ * `a`, `sig_pow` and `noise_pow` must have been initialized (see bfp_s32_init()), and must be
+ * the same length. Negative power values are treated as @math{0}.
+ * 
+ * This operation can be performed safely in-place on `sig_pow` or `noise_pow`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow max\!\left\\{ g_{min}, 
+ *                  \frac{max\\{S_k - N_k, 0\\}}{S_k} \right\\}                     \\
+ * &         \qquad\text{for } k \in 0\ ...\ (L-1)                                \\
+ * &         \qquad\text{where } L \text{ is the length of } \bar{S} \text{ and } \bar{N}   \\
+ * &         \qquad\text{and } g_{min} = gain\_min \cdot 2^{-30}
+ * }
+ * 
+ * @param[out]  a           Output gain BFP vector @vector{A}
+ * @param[in]   sig_pow     Signal power BFP vector @vector{S}
+ * @param[in]   noise_pow   Noise power BFP vector @vector{N}
+ * @param[in]   gain_min    Minimum gain (Q2.30)
+ * 
+ * @see bfp_s32_wiener_gain_dd,
+ *      bfp_complex_s32_apply_gain
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_wiener_gain(
+    bfp_s32_t* a,
+    const bfp_s32_t* sig_pow,
+    const bfp_s32_t* noise_pow,
+    const int32_t gain_min);
+
+
+/**
+ * @brief Compute a decision-directed Wiener noise-suppression gain vector.
+ * 
+ * This is the decision-directed variant of bfp_s32_wiener_gain(). The a priori SNR 
+ * @math{\xi_k} is estimated from a weighted combination of the previous frame's clean signal
+ * power estimate @math{P_k} and the maximum-likelihood estimate from the current frame. 
+ * 
+ * `clean_pow` holds the clean signal power estimate @vector{P}. On input it must contain the
+ * estimate produced by the previous call (or zeros for the first frame), and on output it is
+ * updated with the estimate for the current frame, @math{A_k^2 \cdot S_k}. Its exponent and
+ * headroom are updated by this function.
+ * 
+ * `alpha` is the Q2.30 smoothing factor @math{\alpha}, which must be in the range 
+ * @math{[0, 2^{30}]}. Typical values are around @math{0.98}.
+ * 
+ * The output gains are always given in a Q2.30 format, i.e. upon completion `a->exp` is 
+ * @math{-30}, and all output mantissas lie in the range @math{[gain\_min, 2^{30}]}.
+ * 
+ * `a`, `clean_pow`, `sig_pow` and `noise_pow` must have been initialized (see bfp_s32_init()),
+ * and must be the same length.
+ * 
+ * @operation{
+ * &     \xi_k \leftarrow \alpha \cdot \frac{P_k}{N_k} 
+ *              + (1 - \alpha) \cdot max\\{ \frac{S_k}{N_k} - 1, 0 \\}                 \\
+ * &     A_k \leftarrow max\!\left\\{ g_{min}, \frac{\xi_k}{1 + \xi_k} \right\\}        \\
+ * &     P_k \leftarrow A_k^2 \cdot S_k                                                \\
+ * &         \qquad\text{for } k \in 0\ ...\ (L-1)                                    \\
+ * &         \qquad\text{where } L \text{ is the length of } \bar{S} \text{ and } \bar{N}   \\
+ * &         \qquad\text{and } \alpha = alpha \cdot 2^{-30}                           \\
+ * &         \qquad\text{and } g_{min} = gain\_min \cdot 2^{-30}
+ * }
+ * 
+ * @param[out]      a           Output gain BFP vector @vector{A}
+ * @param[inout]    clean_pow   Clean signal power estimate BFP vector @vector{P}
+ * @param[in]       sig_pow     Signal power BFP vector @vector{S}
+ * @param[in]       noise_pow   Noise power BFP vector @vector{N}
+ * @param[in]       alpha       Smoothing factor (Q2.30)
+ * @param[in]       gain_min    Minimum gain (Q2.30)
+ * 
+ * @see bfp_s32_wiener_gain,
+ *      bfp_complex_s32_apply_gain
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_wiener_gain_dd(
+    bfp_s32_t* a,
+    bfp_s32_t* clean_pow,
+    const bfp_s32_t* sig_pow,
+    const bfp_s32_t* noise_pow,
+    const int32_t alpha,
+    const int32_t gain_min);
+
+
+/** 
+ * @brief Compute the element-wise maximum of two 32-bit BFP vectors.
+ * 
+ * Each element of output BFP vector @vector{A} is the larger of the corresponding elements of input BFP vectors
+ * @vector{B} and @vector{C}.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow max\\{ B_k, C_k \\}                           \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                   \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B} \text{ and } \bar{C}
+ * }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * @param[in]  c     Input BFP vector @vector{C}
+ * 
+ * @see bfp_s32_min_elementwise,
+ *      bfp_s32_max
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_max_elementwise(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c);
+
+
+/** 
+ * @brief Compute the element-wise minimum of two 32-bit BFP vectors.
+ * 
+ * Each element of output BFP vector @vector{A} is the smaller of the corresponding elements of input BFP vectors
+ * @vector{B} and @vector{C}.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow min\\{ B_k, C_k \\}                           \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                   \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B} \text{ and } \bar{C}
+ * }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * @param[in]  c     Input BFP vector @vector{C}
+ * 
+ * @see bfp_s32_max_elementwise,
+ *      bfp_s32_min
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_min_elementwise(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c);
+
+
+/** 
+ * @brief Select elements from one of two 32-bit BFP vectors according to a mask.
+ * 
+ * Each element of output BFP vector @vector{A} is taken from input BFP vector @vector{B} where the corresponding 
+ * element of `mask[]` is non-zero, and from input BFP vector @vector{C} otherwise.
+ * 
+ * `a`, `b` and `c` must have been initialized (see bfp_s32_init()), and must be the same length. `mask[]` must 
+ * have (at least) that many elements.
+ * 
+ * This operation can be performed safely in-place on `b` or `c`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow \begin{cases}
+ *          B_k & mask_k \neq 0 \\
+ *          C_k & otherwise \end{cases}                             \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                   \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B} \text{ and } \bar{C}
+ * }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * @param[in]  c     Input BFP vector @vector{C}
+ * @param[in]  mask  Selection mask
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_select(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c,
+    const int8_t mask[]);
+
+
+/** 
+ * @brief Compute several summary statistics of a 32-bit BFP vector in a single pass.
+ * 
+ * The maximum and minimum elements (and their indices), the sum, the mean and the energy of input BFP vector 
+ * @vector{B} are computed together, reading each element of @vector{B} once, and are stored in `a`.
+ * 
+ * The results are equivalent to those of bfp_s32_max(), bfp_s32_min(), bfp_s32_argmax(), bfp_s32_argmin(), 
+ * bfp_s32_sum(), bfp_s32_mean() and bfp_s32_energy() respectively.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()).
+ * 
+ * @operation{
+ * &     a.max \leftarrow max\left(B_0\, B_1\, ...\, B_{N-1} \right)                    \\
+ * &     a.min \leftarrow min\left(B_0\, B_1\, ...\, B_{N-1} \right)                    \\
+ * &     a.argmax \leftarrow argmax_k\left(B_k\right)                                   \\
+ * &     a.argmin \leftarrow argmin_k\left(B_k\right)                                   \\
+ * &     a.sum \leftarrow \sum_{k=0}^{N-1} B_k                                         \\
+ * &     a.mean \leftarrow \frac{1}{N} \sum_{k=0}^{N-1} B_k                            \\
+ * &     a.energy \leftarrow \sum_{k=0}^{N-1} B_k^2                                    \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * @param[out] a     Output statistics
+ * @param[in]  b     Input BFP vector @vector{B}
+ * 
+ * @see bfp_s32_stats_t
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_stats(
+    bfp_s32_stats_t* a,
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Get the variance of a 32-bit BFP vector.
+ * 
+ * The (population) variance of input BFP vector @vector{B} is computed and returned.
+ * 
+ * The variance is found in a single pass over @vector{B}. Elements are taken relative to the first element 
+ * @math{B_0} and their sum and sum of squares are accumulated exactly in 64 bits, so the result does not 
+ * suffer from cancellation when the mean of @vector{B} is large relative to its spread.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()), and its length must be non-zero.
+ * 
+ * @operation{
+ * &     \mu \leftarrow \frac{1}{N} \sum_{k=0}^{N-1} B_k                               \\
+ * &     a \leftarrow \frac{1}{N} \sum_{k=0}^{N-1} \left(B_k - \mu\right)^2            \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * @param[in]  b     Input BFP vector @vector{B}
+ * 
+ * @returns @math{a}, the variance of @vector{B}
+ * 
+ * @see bfp_s32_std
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_s32_variance(
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Get the standard deviation of a 32-bit BFP vector.
+ * 
+ * The (population) standard deviation of input BFP vector @vector{B} is computed and returned. This is the
+ * square root of the result of bfp_s32_variance().
+ * 
+ * `b` must have been initialized (see bfp_s32_init()), and its length must be non-zero.
+ * 
+ * @operation{
+ * &     a \leftarrow \sqrt{\frac{1}{N} \sum_{k=0}^{N-1} \left(B_k - \mu\right)^2}    \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}                   \\
+ * &         \qquad\text{and } \mu \text{ is the mean of } \bar{B}
+ * }
+ * 
+ * @param[in]  b     Input BFP vector @vector{B}
+ * 
+ * @returns @math{a}, the standard deviation of @vector{B}
+ * 
+ * @see bfp_s32_variance
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_s32_std(
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Normalize a 32-bit BFP vector to zero mean and unit variance.
+ * 
+ * Each element of input BFP vector @vector{B} has the mean of @vector{B} subtracted and is then divided by 
+ * the standard deviation of @vector{B}. The result is output to BFP vector @vector{A}.
+ * 
+ * This takes two passes over @vector{B}: one to compute its mean and variance (as bfp_s32_variance()) and one 
+ * which applies the subtraction and scaling together as a single fused multiply-add per element.
+ * 
+ * If every element of @vector{B} is equal, @vector{A} is set to zero.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s32_init()), and must be the same length, which must be 
+ * non-zero.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow \frac{B_k - \mu}{\sigma}                                        \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)                                      \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}                    \\
+ * &         \qquad\text{and } \mu \text{ and } \sigma \text{ are the mean and standard deviation of } \bar{B}
+ * }
+ * 
+ * @param[out] a     Output BFP vector @vector{A}
+ * @param[in]  b     Input BFP vector @vector{B}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_normalize(
+    bfp_s32_t* a,
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Get the indices and values of the `K` largest elements of a 32-bit BFP vector.
+ * 
+ * Finds the `K` largest elements of input BFP vector @vector{B}. Their indices are output to `indices[]` and (if 
+ * `values` is not `NULL`) their values to `values[]`, both in order of decreasing value.
+ * 
+ * If there is a tie in value, the lower index comes first, so `indices[0]` is the index returned by 
+ * bfp_s32_argmax().
+ * 
+ * This takes a single pass over @vector{B} (see xs3_vect_s32_topk()), rather than one pass per selected element.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()), and `K` must not exceed its length.
+ * 
+ * @operation{
+ * &     i_0 \leftarrow argmax_k\left(B_k\right)                                           \\
+ * &     i_j \leftarrow argmax_k\left(B_k\right) \text{ for } k \notin \\{ i_0, ..., i_{j-1} \\}  \\
+ * &     v_j \leftarrow B_{i_j}                                                           \\
+ * &         \qquad\text{for } j \in 0\ ...\ (K-1)
+ * }
+ * 
+ * @param[out] indices  Output indices @math{i_j}
+ * @param[out] values   Output values @math{v_j}, or `NULL`
+ * @param[in]  b        Input vector @vector{B}
+ * @param[in]  K        Number of elements to select
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_topk(
+    unsigned indices[],
+    float_s32_t values[],
+    const bfp_s32_t* b,
+    const unsigned K);
+
+
+/** 
+ * @brief Get a percentile of a 32-bit BFP vector.
+ * 
+ * Finds the element of input BFP vector @vector{B} below which a fraction @math{p} of the other elements lie, 
+ * where `p` is given as a Q2.30 value in the range @math{[0, 2^{30}]}. A `p` of `0x20000000` gives the median (the
+ * lower median when the length of @vector{B} is even), `0` the minimum and `0x40000000` the maximum.
+ * 
+ * The elements of @vector{B} share an exponent, so they are ordered by comparing mantissas directly. A histogram 
+ * of @vector{B} (see xs3_vect_s32_histogram()) first locates the bin containing the requested rank. Only the 
+ * elements in that bin are copied to `scratch[]`, where quickselect (see xs3_vect_s32_nth_element()) finds the 
+ * requested element among them. @vector{B} is not modified, and it is never fully sorted.
+ * 
+ * `scratch[]` must have space for as many elements as @vector{B} in the worst case (when most elements share a 
+ * bin), and must be word-aligned.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()), and its length must be non-zero.
+ * 
+ * @operation{
+ * &     a \leftarrow B'_{\lfloor p \cdot (N-1) \rfloor}                                \\
+ * &         \qquad\text{where } \bar{B'} \text{ is } \bar{B} \text{ sorted in ascending order}  \\
+ * &         \qquad\text{and } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * @param[in]  b        Input BFP vector @vector{B}
+ * @param[in]  p        Percentile @math{p}, as a fraction (Q2.30)
+ * @param[in]  scratch  Scratch buffer
+ * 
+ * @returns @math{a}, the requested percentile of @vector{B}
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s32_t bfp_s32_percentile(
+    const bfp_s32_t* b,
+    const fixed_s32_t p,
+    int32_t scratch[]);
+
+
+/** 
+ * @brief Apply a soft-clipping curve to a 32-bit BFP vector.
+ * 
+ * Each element of input BFP vector @vector{B} is passed through the soft-clipping (saturating waveshaper) curve
+ * @math{f()} selected by `curve`, and the result is output to BFP vector @vector{A}. The curves are unity-gain for
+ * small inputs and saturate smoothly towards @math{\pm 1}. See @ref softclip_curve_e for the available curves.
+ * 
+ * To soft-clip at a level @math{L} other than @math{1}, scale @vector{B} by @math{1/L} beforehand and @vector{A} 
+ * by @math{L} afterwards (see bfp_s32_scale()).
+ * 
+ * `a` and `b` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow f(B_k)                               \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)          \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{A} \text{ and } \bar{B}
+ * }
+ * 
+ * @param[out] a        Output BFP vector @vector{A}
+ * @param[in]  b        Input BFP vector @vector{B}
+ * @param[in]  curve    Soft-clipping curve
+ * 
+ * @see xs3_vect_s32_softclip
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_softclip(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const softclip_curve_e curve);
+
+
+/** 
+ * @brief Compute the cumulative sum of a 32-bit BFP vector.
+ * 
+ * Each element of output BFP vector @vector{A} is the sum of the elements of input BFP vector @vector{B} up to and
+ * including the corresponding position. The running sum is kept exactly in 64 bits and the output exponent is 
+ * chosen so that the result cannot saturate, so each output element is accurate to within half an LSB.
+ * 
+ * `a` and `b` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * This operation can be performed safely in-place on `b`.
+ * 
+ * @operation{
+ * &     A_k \leftarrow \sum_{i=0}^{k} B_i                   \\
+ * &         \qquad\text{for } k \in 0\ ...\ (N-1)          \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{A} \text{ and } \bar{B}
+ * }
+ * 
+ * @param[out] a        Output BFP vector @vector{A}
+ * @param[in]  b        Input BFP vector @vector{B}
+ * 
+ * @see xs3_vect_s32_cumsum
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_cumsum(
+    bfp_s32_t* a,
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Build a multi-resolution min/max/mean-square summary (pyramid) of a 32-bit BFP vector.
+ * 
+ * For each level @math{l} from @math{1} to @math{L}, input BFP vector @vector{B} is divided into aligned blocks
+ * of @math{2^l} elements, and the maximum, minimum and mean-square of each block are output to BFP vectors
+ * @vector{M}, @vector{m} and @vector{P} respectively. All levels are computed in a single pass over @vector{B}.
+ * 
+ * In each output vector the levels are laid out contiguously, from finest to coarsest. Level @math{l} has 
+ * @math{N \cdot 2^{-l}} elements and begins at offset @math{N - N \cdot 2^{1-l}}, where @math{N} is the length 
+ * of @vector{B}. For example, with @math{N=16} and @math{L=3}, level @math{1} occupies elements @math{0} to 
+ * @math{7}, level @math{2} elements @math{8} to @math{11} and level @math{3} elements @math{12} and @math{13}.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()), and its length must be a multiple of @math{2^L}. `max`, 
+ * `min` and `mean_sq` must have been initialized with length @math{N - N \cdot 2^{-L}}.
+ * 
+ * The RMS of any block can be found as the square root of the corresponding element of @vector{P}.
+ * 
+ * @operation{
+ * &     M^{(l)}_k \leftarrow max\left(B_{2^l k}, ..., B_{2^l (k+1) - 1}\right)                  \\
+ * &     m^{(l)}_k \leftarrow min\left(B_{2^l k}, ..., B_{2^l (k+1) - 1}\right)                  \\
+ * &     P^{(l)}_k \leftarrow 2^{-l} \sum_{i=2^l k}^{2^l (k+1) - 1} B_i^2                          \\
+ * &         \qquad\text{for } l \in 1\ ...\ L \text{ and } k \in 0\ ...\ (N \cdot 2^{-l} - 1)
+ * }
+ * 
+ * @param[out] max      Output BFP vector of block maxima @vector{M}
+ * @param[out] min      Output BFP vector of block minima @vector{m}
+ * @param[out] mean_sq  Output BFP vector of block mean-squares @vector{P}
+ * @param[in]  b        Input BFP vector @vector{B}
+ * @param[in]  levels   Number of levels @math{L}
+ * 
+ * @see xs3_vect_s32_pyramid
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_pyramid(
+    bfp_s32_t* max,
+    bfp_s32_t* min,
+    bfp_s32_t* mean_sq,
+    const bfp_s32_t* b,
+    const unsigned levels);
+
+
+/** 
+ * @brief Get the energy and zero-crossing count of a 32-bit BFP vector in a single pass.
+ * 
+ * The energy of input BFP vector @vector{B} is computed as with bfp_s32_energy(), and the number of sign changes
+ * between neighbouring elements of @vector{B} is output to `zero_crossings`. Zero is treated as non-negative. 
+ * These are the time-domain features typically used for voice activity detection.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()).
+ * 
+ * @operation{
+ * &     a \leftarrow \sum_{k=0}^{N-1} \left( B_k^2 \right)                        \\
+ * &     z \leftarrow \sum_{k=1}^{N-1} \left[ (B_k < 0) \ne (B_{k-1} < 0) \right]    \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * @param[out] zero_crossings   Output zero-crossing count @math{z}
+ * @param[in]  b                Input BFP vector @vector{B}
+ * 
+ * @returns    @math{a}, the energy of vector @vector{B}
+ * 
+ * @see xs3_vect_s32_energy_zcr
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+float_s64_t bfp_s32_energy_zcr(
+    unsigned* zero_crossings,
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Get the spectral flatness of a 32-bit BFP power spectrum.
+ * 
+ * The spectral flatness is the ratio of the geometric mean to the arithmetic mean of the elements of input BFP 
+ * vector @vector{B}, which holds the (non-negative) power of each frequency bin. It is close to @math{1} for 
+ * noise-like frames and close to @math{0} for tonal frames. If any element of @vector{B} is zero, the result is zero.
+ * 
+ * `b` must have been initialized (see bfp_s32_init()).
+ * 
+ * @operation{
+ * &     a \leftarrow \frac{\left( \prod_{k=0}^{N-1} B_k \right)^{1/N}}{\frac{1}{N}\sum_{k=0}^{N-1} B_k}    \\
+ * &         \qquad\text{where } N \text{ is the length of } \bar{B}
+ * }
+ * 
+ * @param[in]  b        Input BFP vector @vector{B}
+ * 
+ * @returns    @math{a}, the spectral flatness of @vector{B}, as a Q2.30 value
+ * 
+ * @see xs3_vect_s32_spectral_flatness
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+fixed_s32_t bfp_s32_spectral_flatness(
+    const bfp_s32_t* b);
+
+
+/** 
+ * @brief Compute the weighted sum of several delayed 32-bit BFP vectors (delay-and-sum).
+ * 
+ * Each element of output BFP vector @vector{A} is the sum over `channels` input BFP vectors @vector{B_i}, each 
+ * delayed by @math{d_i} samples and scaled by weight @math{g_i}. This is a time-domain delay-and-sum beamformer.
+ * 
+ * A single output exponent is chosen up front from the exponents and headrooms of the inputs, after which the output 
+ * is computed in one pass, so this is considerably cheaper than summing the channels pairwise with bfp_s32_add().
+ * 
+ * Each input vector holds the current frame of its channel preceded by enough history to apply its delay. That is, 
+ * if @math{N} is the length of @vector{A}, the current frame of channel @math{i} is the last @math{N} elements of 
+ * @vector{B_i}, and the length of @vector{B_i} must be at least @math{N + d_i}. Fractional delays can be applied 
+ * beforehand with an `xs3_delay_s32_t`.
+ * 
+ * `a` must have been initialized (see bfp_s32_init()) with the required output length. Each `b[i]` must have been 
+ * initialized. `channels` must not exceed `XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS` (see @ref 
+ * conf_option_delay_and_sum_channels).
+ * 
+ * @operation{
+ * &     A_k \leftarrow \sum_{i=0}^{channels-1} g_i \cdot B_{i,\ L_i - N + k - d_i}                            \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (N-1)                                                        \\
+ * &         \qquad\text{ where } L_i \text{ is the length of } \bar{B_i} \text{ and } N \text{ the length of } \bar{A}
+ * }
+ * 
+ * @param[inout] a          Output BFP vector @vector{A}
+ * @param[in]    b          Input BFP vectors @vector{B_i}
+ * @param[in]    gain_q30   Channel weights @math{g_i}, as Q2.30 values
+ * @param[in]    delay      Channel delays @math{d_i}, in samples
+ * @param[in]    channels   Number of input vectors
+ * 
+ * @see xs3_vect_s32_weighted_sum
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_delay_and_sum(
+    bfp_s32_t* a,
+    const bfp_s32_t b[],
+    const fixed_s32_t gain_q30[],
+    const unsigned delay[],
+    const unsigned channels);
+
+
+/** 
+ * @brief Update a bank of one-pole smoothers held in a 32-bit BFP vector.
+ * 
+ * Each element of BFP vector @vector{Y} is the state of a first-order lowpass smoother, which is moved towards the 
+ * corresponding element of input BFP vector @vector{X} by the fraction @math{c} of the difference between them. 
+ * This is done in a single pass over the data, with the exponent of the updated @vector{Y} chosen up front.
+ * 
+ * `y` and `x` must have been initialized (see bfp_s32_init()), and must be the same length.
+ * 
+ * @operation{
+ * &     Y_k \leftarrow Y_k + c \cdot (X_k - Y_k)                            \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (N-1)                          \\
+ * &         \qquad\text{ where } N \text{ is the length of } \bar{Y} \text{ and } \bar{X}
+ * }
+ * 
+ * @param[inout] y          Smoother state BFP vector @vector{Y}
+ * @param[in]    x          Input BFP vector @vector{X}
+ * @param[in]    coef_q30   Smoothing coefficient @math{c}, a Q2.30 value in the range @math{[0, 1]}
+ * 
+ * @see xs3_vect_s32_smooth,
+ *      bfp_s32_smooth_vect
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_smooth(
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const fixed_s32_t coef_q30);
+
+
+/** 
+ * @brief Update a bank of one-pole smoothers held in a 32-bit BFP vector, with per-element coefficients.
+ * 
+ * This is the same as bfp_s32_smooth(), except that each smoother has its own coefficient @math{c_k}.
+ * 
+ * `y` and `x` must have been initialized (see bfp_s32_init()), and must be the same length. `coef_q30[]` must have 
+ * one element per element of `y`.
+ * 
+ * @operation{
+ * &     Y_k \leftarrow Y_k + c_k \cdot (X_k - Y_k)                          \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (N-1)                          \\
+ * &         \qquad\text{ where } N \text{ is the length of } \bar{Y} \text{ and } \bar{X}
+ * }
+ * 
+ * @param[inout] y          Smoother state BFP vector @vector{Y}
+ * @param[in]    x          Input BFP vector @vector{X}
+ * @param[in]    coef_q30   Smoothing coefficients @math{c_k}, Q2.30 values in the range @math{[0, 1]}
+ * 
+ * @see xs3_vect_s32_smooth_vect,
+ *      bfp_s32_smooth
+ * 
+ * @ingroup bfp32_func
+ */
+C_API
+void bfp_s32_smooth_vect(
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const fixed_s32_t coef_q30[]);
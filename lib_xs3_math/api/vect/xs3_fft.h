@@ -49,6 +49,90 @@ void xs3_fft_index_bit_reversal(
     complex_s32_t x[],
     const unsigned length);
 
+/**
+ * @brief Interleave two real vectors into a complex vector in bit-reversed order, in a single pass.
+ * 
+ * This function performs the same operation as xs3_vect_s32_zip() followed by xs3_fft_index_bit_reversal(), but 
+ * each element is written directly to its final (bit-reversed) position. This is the preparation required to 
+ * compute the DFTs of two real signals @math{b[n]} and @math{c[n]} together, with a single complex FFT 
+ * (xs3_fft_dit_forward()) of @math{x[n] = b[n] + j\cdot c[n]}.
+ * 
+ * `a[]` is the complex output vector. `b[]` and `c[]` are the real input vectors, whose elements are placed in the
+ * real and imaginary parts of `a[]` respectively. Each vector must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors. It must be a power of 2.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to elements of `b[]` and `c[]` respectively.
+ * As with the VPU's `VLASHR` instruction, the shifted values saturate to 32 bits.
+ * 
+ * If `a[]` and `b[]` are the same address and `c[]` immediately follows `b[]` in memory (that is, 
+ * `c == &b[length]`), the operation is performed in-place, and no scratch buffer is needed to hold `a[]`. Any other
+ * overlap between the output and the inputs is not supported.
+ * 
+ * @operation{
+ * &     a_{bitrev(k)} \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor) + j\cdot sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor) \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Complex output vector
+ * @param[in]   b       Real input vector (real parts of output)
+ * @param[in]   c       Real input vector (imaginary parts of output)
+ * @param[in]   length  Number of elements in each vector
+ * @param[in]   b_shr   Right-shift applied to elements of `b[]`
+ * @param[in]   c_shr   Right-shift applied to elements of `c[]`
+ * 
+ * @see xs3_fft_unzip_bit_reversal
+ * 
+ * @ingroup xs3_fft_func
+ */
+C_API
+void xs3_fft_zip_bit_reversal(
+    complex_s32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+/**
+ * @brief De-interleave a complex vector in bit-reversed order into two real vectors, in a single pass.
+ * 
+ * This function performs the same operation as xs3_fft_index_bit_reversal() followed by xs3_vect_s32_unzip(), but 
+ * each element is read directly from its bit-reversed position. It is the inverse of xs3_fft_zip_bit_reversal()
+ * (ignoring shifts), and so can be applied to the bit-reversed output of xs3_fft_dif_inverse() to recover two real 
+ * signals which were inverse-transformed together.
+ * 
+ * `a[]` and `b[]` are the real output vectors, which receive the real and imaginary parts of `c[]` respectively.
+ * `c[]` is the complex input vector. Each vector must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in each of the vectors. It must be a power of 2.
+ * 
+ * If `a[]` and `c[]` are the same address and `b[]` immediately follows `a[]` in memory (that is, 
+ * `b == &a[length]`), the operation is performed in-place. Any other overlap between the outputs and the input is 
+ * not supported.
+ * 
+ * @operation{
+ * &     a_k \leftarrow Re\\{c_{bitrev(k)}\\}                     \\
+ * &     b_k \leftarrow Im\\{c_{bitrev(k)}\\}                     \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[out]  a       Real output vector (real parts of input)
+ * @param[out]  b       Real output vector (imaginary parts of input)
+ * @param[in]   c       Complex input vector
+ * @param[in]   length  Number of elements in each vector
+ * 
+ * @see xs3_fft_zip_bit_reversal
+ * 
+ * @ingroup xs3_fft_func
+ */
+C_API
+void xs3_fft_unzip_bit_reversal(
+    int32_t a[],
+    int32_t b[],
+    const complex_s32_t c[],
+    const unsigned length);
+
 /**
  * @brief Splits the merged spectrum that results from DFTing a pair of real signals together.
  * 
@@ -10,7 +10,7 @@
  * @page page_xs3_filters_h  xs3_filters.h
  * 
  * This header contains XS3-optimized functions and types for initializing and executing 
- * 16- and 32-bit FIR filters, as well as 32-bit biquad filters.
+ * 16- and 32-bit FIR filters, as well as 32-bit biquad filters and fractional delay lines.
  * 
  * @note This header is included automatically through `xs3_math.h` or `bfp_math.h`.
  * 
@@ -652,3 +652,465 @@ int32_t xs3_filter_biquads_s32(
     const unsigned block_count,
     const int32_t new_sample);
 
+
+/**
+ * @brief A 32-bit fractional delay line.
+ * 
+ * This struct represents a circular buffer of 32-bit samples from which delayed copies of the input signal can be read
+ * at arbitrary (fractional) delays. Any number of read taps may share a single delay line, which makes it suitable for
+ * time-domain beam steering, modulated delay effects (chorus, flanger) and sample-rate drift compensation.
+ * 
+ * Samples are added to the delay line in blocks using xs3_delay_s32_write(). Delayed blocks of the same length are
+ * then read using xs3_delay_s32_read() (one tap) or xs3_delay_s32_read_taps() (several taps).
+ * 
+ * Delays are specified in samples as fixed-point values with 16 fractional bits. The integer part of the delay selects the samples to be
+ * used and the fractional part @math{\mu} is applied using 3rd order (4-point) Lagrange interpolation. The 3rd order
+ * Lagrange weights are computed once per tap per block, after which each output sample is a 4-tap dot product 
+ * accumulated with the VPU's 40-bit multiply-accumulate semantics.
+ * 
+ * Interpolation requires one sample beyond the nominal read position in each direction, so delays must be at least
+ * `1.0` samples. Reading `count` samples with a delay of @math{D} samples requires that the delay line's length be at
+ * least @math{\lfloor D \rfloor + count + 2}.
+ * 
+ * This struct should be initialized with xs3_delay_s32_init().
+ * 
+ * @ingroup xs3_filter_type
+ */
+C_API
+typedef struct {
+    /** Number of samples in `buffer`. */
+    unsigned length;
+    /** Index in `buffer` at which the next input sample will be written. */
+    unsigned head;
+    /** Circular sample buffer. */
+    int32_t* buffer;
+} xs3_delay_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit fractional delay line.
+ * 
+ * `buffer` is cleared to zeros and used as the delay line's sample storage.
+ * 
+ * @param[out]  delay       Delay line to be initialized
+ * @param[in]   buffer      Sample buffer of `length` elements
+ * @param[in]   length      Length of `buffer` in samples
+ * 
+ * @see xs3_delay_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_delay_s32_init(
+    xs3_delay_s32_t* delay,
+    int32_t buffer[],
+    const unsigned length);
+
+
+/**
+ * @brief Add a block of samples to a 32-bit fractional delay line.
+ * 
+ * The `count` samples of `input[]` are written to `delay` in order, `input[count-1]` becoming the most recent sample.
+ * 
+ * @param[inout]    delay       Delay line to be updated
+ * @param[in]       input       New input samples
+ * @param[in]       count       Number of samples in `input[]`. Must not exceed `delay->length`
+ * 
+ * @see xs3_delay_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_delay_s32_write(
+    xs3_delay_s32_t* delay,
+    const int32_t input[],
+    const unsigned count);
+
+
+/**
+ * @brief Read a delayed block of samples from a 32-bit fractional delay line.
+ * 
+ * Output sample `output[k]` is the delay line's input signal delayed by `delay_q16` samples, relative to the time of 
+ * the `k`th sample of the most recent `count` samples written. If `x[t]` is the most recently written sample then
+ * 
+ * @operation{
+ * &     y_k \leftarrow x[t - (count - 1) + k - D]                \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (count-1)             \\
+ * &         \qquad\text{ where } D = delay\_q16 \cdot 2^{-16}
+ * }
+ * 
+ * where samples between integer times are reconstructed by 3rd order Lagrange interpolation. For integer delays the
+ * output is an exact copy of the delayed input.
+ * 
+ * Delay lines are not modified by reads, so this may be called any number of times between calls to
+ * xs3_delay_s32_write().
+ * 
+ * @param[in]   delay       Delay line to read from
+ * @param[out]  output      Output samples
+ * @param[in]   count       Number of samples to read
+ * @param[in]   delay_q16   Delay in samples, with 16 fractional bits. Must be at least `0x10000`
+ * 
+ * @see xs3_delay_s32_t,
+ *      xs3_delay_s32_read_taps
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_delay_s32_read(
+    const xs3_delay_s32_t* delay,
+    int32_t output[],
+    const unsigned count,
+    const fixed_s32_t delay_q16);
+
+
+/**
+ * @brief Read delayed blocks of samples from several taps of a 32-bit fractional delay line.
+ * 
+ * This is equivalent to calling xs3_delay_s32_read() once for each element of `delay_q16[]`. Outputs are planar: the
+ * block for tap `i` is written to `output[i*count]` through `output[i*count + count - 1]`.
+ * 
+ * @param[in]   delay       Delay line to read from
+ * @param[out]  output      Output samples, `tap_count * count` elements
+ * @param[in]   count       Number of samples to read for each tap
+ * @param[in]   delay_q16   Delay of each tap in samples, with 16 fractional bits
+ * @param[in]   tap_count   Number of taps
+ * 
+ * @see xs3_delay_s32_t,
+ *      xs3_delay_s32_read
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_delay_s32_read_taps(
+    const xs3_delay_s32_t* delay,
+    int32_t output[],
+    const unsigned count,
+    const fixed_s32_t delay_q16[],
+    const unsigned tap_count);
+
+
+/**
+ * @brief A 32-bit lattice-ladder IIR filter.
+ * 
+ * This struct represents an order-@math{M} all-pole or pole-zero IIR filter implemented in the lattice-ladder form.
+ * Unlike a cascade of biquad sections, the lattice form is parameterized directly by the reflection coefficients
+ * produced by linear prediction analysis, and remains well-conditioned at high orders (e.g. the order 10 to 24 
+ * synthesis filters used in speech codecs and warped linear prediction).
+ * 
+ * The filter has @math{M} reflection coefficients @math{k_1 ... k_M}, stored in `refl_coef[0]` to 
+ * `refl_coef[M-1]`, and optionally @math{M+1} ladder coefficients @math{v_0 ... v_M}, stored in `ladder_coef[]`. All 
+ * coefficients are Q2.30 values. The filter is stable if every @math{|k_m| < 1}.
+ * 
+ * For each input sample @math{x[n]}, the forward and backward prediction errors @math{f_m[n]} and @math{g_m[n]} are
+ * updated from the highest stage to the lowest:
+ * 
+ * @math{ f_M[n] = x[n] }
+ * 
+ * @math{ f_{m-1}[n] = f_m[n] - k_m \cdot g_{m-1}[n-1] }
+ * 
+ * @math{ g_m[n] = k_m \cdot f_{m-1}[n] + g_{m-1}[n-1] }
+ * 
+ * @math{ g_0[n] = f_0[n] }
+ * 
+ * If `ladder_coef` is `NULL` the filter is all-pole, with transfer function @math{1/A(z)}, and the output is 
+ * @math{y[n] = f_0[n]}. Otherwise the output is the pole-zero (ARMA) response 
+ * @math{y[n] = \sum_{m=0}^{M} v_m \cdot g_m[n]}.
+ * 
+ * Each product has a rounding 30-bit right-shift applied and is accumulated with 40-bit saturation, as with the VPU's
+ * multiply-accumulate instructions. Stage outputs and filter outputs are saturated to 32 bits.
+ * 
+ * The state data is the @math{M} words @math{g_0[n-1] ... g_{M-1}[n-1]}.
+ * 
+ * This struct should be initialized with xs3_filter_lattice_s32_init(), and is processed with 
+ * xs3_filter_lattice_s32().
+ * 
+ * @ingroup xs3_filter_type
+ */
+C_API
+typedef struct {
+    /** Filter order @math{M}. */
+    unsigned order;
+    /** Reflection coefficients @math{k_1 ... k_M}, Q2.30. */
+    const int32_t* refl_coef;
+    /** Ladder coefficients @math{v_0 ... v_M}, Q2.30, or `NULL` for an all-pole filter. */
+    const int32_t* ladder_coef;
+    /** Filter state, @math{g_0[n-1] ... g_{M-1}[n-1]}. */
+    int32_t* state;
+} xs3_filter_lattice_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit lattice-ladder IIR filter.
+ * 
+ * `state_buffer` is cleared to zeros and used to hold the filter's state. The coefficient arrays are not copied.
+ * 
+ * @param[out]  filter          Filter struct to be initialized
+ * @param[in]   state_buffer    Buffer of at least `order` elements used for filter state
+ * @param[in]   order           Filter order @math{M}
+ * @param[in]   refl_coef       @math{M} reflection coefficients, Q2.30
+ * @param[in]   ladder_coef     @math{M+1} ladder coefficients, Q2.30, or `NULL` for an all-pole filter
+ * 
+ * @see xs3_filter_lattice_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_lattice_s32_init(
+    xs3_filter_lattice_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned order,
+    const int32_t refl_coef[],
+    const int32_t ladder_coef[]);
+
+
+/**
+ * @brief Process a block of samples with a 32-bit lattice-ladder IIR filter.
+ * 
+ * Each of the `length` samples of `input[]` is processed in order by `filter` as specified in 
+ * `xs3_filter_lattice_s32_t`, and the output samples are written to `output[]`. `output` may alias `input` for 
+ * in-place processing.
+ * 
+ * Processing a signal in several blocks gives exactly the same output as processing it in one block.
+ * 
+ * @param[inout]    filter      Filter to be processed
+ * @param[out]      output      Output samples
+ * @param[in]       input       Input samples
+ * @param[in]       length      Number of samples to process
+ * 
+ * @see xs3_filter_lattice_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_lattice_s32(
+    xs3_filter_lattice_s32_t* filter,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length);
+
+
+/**
+ * @brief A bank of up to 8 32-bit state-variable filters.
+ * 
+ * This struct holds the coefficients and state of up to 8 second-order state-variable filters (SVFs) in the 
+ * topology-preserving transform (TPT, or "zero-delay feedback") form. Every filter in the bank processes the same 
+ * input signal and simultaneously produces lowpass, bandpass and highpass outputs, which makes a bank a simple way of 
+ * splitting a signal into bands. As with `xs3_biquad_filter_s32_t`, coefficients and states are stored lane-major, 
+ * with one filter per lane of each 8-element row.
+ * 
+ * Each filter @math{i} is parameterized by its prewarped cutoff gain @math{g_i = tan(\pi f_c / f_s)} and its damping
+ * @math{k_i = 1/Q}. For each input sample @math{x}, with @math{s_1} and @math{s_2} the filter's two integrator 
+ * states:
+ * 
+ * @math{ v_3 = x - s_2 }
+ * 
+ * @math{ v_1 = a_1 s_1 + a_2 v_3 }
+ * 
+ * @math{ v_2 = s_2 + a_2 s_1 + a_3 v_3 }
+ * 
+ * @math{ s_1 \leftarrow 2 v_1 - s_1, \quad s_2 \leftarrow 2 v_2 - s_2 }
+ * 
+ * @math{ lowpass = v_2, \quad bandpass = v_1, \quad highpass = x - k v_1 - v_2 }
+ * 
+ * where @math{a_1 = 1 / (1 + g (g + k))}, @math{a_2 = g a_1} and @math{a_3 = g a_2}.
+ * 
+ * Products have a rounding 30-bit right-shift applied and are accumulated with 40-bit saturation, and all outputs and
+ * states are saturated to 32 bits.
+ * 
+ * This struct should be initialized with xs3_filter_svf_bank_s32_init().
+ * 
+ * @ingroup xs3_filter_type
+ */
+C_API
+typedef struct {
+    /**
+     * The number of filters in this bank.
+     */
+    unsigned filter_count;
+
+    /**
+     * Filter states. state[0][i] and state[1][i] are the integrator states @math{s_1} and @math{s_2} of the ith
+     * filter.
+     */
+    int32_t state[2][8];
+
+    /**
+     * Filter coefficients. coef[j][i] is for the ith filter, with j mapping to @math{a_1}, @math{a_2}, @math{a_3} 
+     * and @math{k}, in that order. All are Q2.30 values.
+     */
+    int32_t coef[4][8];
+} xs3_filter_svf_bank_s32_t;
+
+
+/**
+ * @brief Initialize a bank of 32-bit state-variable filters.
+ * 
+ * The coefficients of each of the `filter_count` filters are computed from the prewarped cutoff gain @math{g_i} and 
+ * damping @math{k_i} as described in `xs3_filter_svf_bank_s32_t`, and the filter states are cleared.
+ * 
+ * Both @math{g_i} and @math{k_i} must be non-negative and less than @math{2}. The restriction on @math{g_i} 
+ * corresponds to cutoff frequencies below about @math{0.35 f_s}.
+ * 
+ * @param[out]  bank            Filter bank to be initialized
+ * @param[in]   filter_count    Number of filters in the bank, at most 8
+ * @param[in]   g_q30           Prewarped cutoff gain @math{g_i} of each filter, Q2.30
+ * @param[in]   k_q30           Damping @math{k_i} of each filter, Q2.30
+ * 
+ * @see xs3_filter_svf_bank_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_svf_bank_s32_init(
+    xs3_filter_svf_bank_s32_t* bank,
+    const unsigned filter_count,
+    const fixed_s32_t g_q30[],
+    const fixed_s32_t k_q30[]);
+
+
+/**
+ * @brief Process a block of samples with a bank of 32-bit state-variable filters.
+ * 
+ * Each of the `length` samples of `input[]` is processed by every filter in `bank`, as specified in 
+ * `xs3_filter_svf_bank_s32_t`. The outputs are planar: the lowpass output of the ith filter is written to 
+ * `lowpass[i*length]` through `lowpass[i*length + length - 1]`, and similarly for `bandpass` and `highpass`. Any of the
+ * output pointers may be `NULL` if that response is not needed.
+ * 
+ * Processing a signal in several blocks gives exactly the same output as processing it in one block.
+ * 
+ * @param[inout]    bank        Filter bank to be processed
+ * @param[out]      lowpass     Lowpass outputs, `bank->filter_count * length` elements, or `NULL`
+ * @param[out]      bandpass    Bandpass outputs, `bank->filter_count * length` elements, or `NULL`
+ * @param[out]      highpass    Highpass outputs, `bank->filter_count * length` elements, or `NULL`
+ * @param[in]       input       Input samples
+ * @param[in]       length      Number of samples to process
+ * 
+ * @see xs3_filter_svf_bank_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_svf_bank_s32(
+    xs3_filter_svf_bank_s32_t* bank,
+    int32_t lowpass[],
+    int32_t bandpass[],
+    int32_t highpass[],
+    const int32_t input[],
+    const unsigned length);
+
+
+/**
+ * Maximum number of bands in an `xs3_filter_crossover_s32_t`.
+ * 
+ * @ingroup xs3_filter_type
+ */
+#define XS3_FILTER_CROSSOVER_MAX_BANDS      (4)
+
+/**
+ * Number of biquad lanes in an `xs3_filter_crossover_s32_t`.
+ * 
+ * @ingroup xs3_filter_type
+ */
+#define XS3_FILTER_CROSSOVER_LANES          (16)
+
+
+/**
+ * @brief A 32-bit Linkwitz-Riley crossover network.
+ * 
+ * This struct represents a crossover which splits a signal into 2 to 4 bands using 4th order Linkwitz-Riley (LR4)
+ * filters, as used by multiband dynamics processors. The bands sum to an allpass response, so the signal is
+ * reconstructed (up to phase) by adding them back together.
+ * 
+ * The signal is split recursively at the middle crossover frequency. Each split is an LR4 lowpass and highpass pair
+ * (two Butterworth biquads each), and each branch is passed through the 2nd order allpass of every crossover 
+ * frequency in the other branch, so that all bands have the same phase response.
+ * 
+ * The biquad sections of the whole network are held in one structure with the same coefficient layout as 
+ * `xs3_biquad_filter_s32_t` (rows @math{b_0}, @math{b_1}, @math{b_2}, @math{-a_1} and @math{-a_2}, with one lane per
+ * section), but with 16 lanes. Rather than forming a fixed cascade, each lane takes its input either from the 
+ * crossover input or from the output of an earlier lane, so a block of samples for the whole network is processed by 
+ * one call to xs3_filter_crossover_s32(). That function is a scalar implementation of this 16-section network; 
+ * unlike xs3_filter_biquad_s32(), it does not use the VPU, and the sections are computed one at a time.
+ * 
+ * A 2-band crossover uses 4 lanes, a 3-band crossover 9 lanes, and a 4-band crossover 14 lanes.
+ * 
+ * Coefficients are Q2.30 and products are accumulated with 40-bit saturation. Section outputs are saturated to 32 
+ * bits, so the input should have at least 1 bit of headroom.
+ * 
+ * This struct should be initialized with xs3_filter_crossover_s32_init().
+ * 
+ * @ingroup xs3_filter_type
+ */
+C_API
+typedef struct {
+    /** Number of output bands. */
+    unsigned band_count;
+
+    /** Number of lanes (biquad sections) in use. */
+    unsigned section_count;
+
+    /** Input of each lane. 0 is the crossover input, and @math{j+1} is the output of lane @math{j < i}. */
+    uint8_t source[XS3_FILTER_CROSSOVER_LANES];
+
+    /** Lane whose output is each band, lowest band first. */
+    uint8_t band_lane[XS3_FILTER_CROSSOVER_MAX_BANDS];
+
+    /** 
+     * Filter state. state[0][i] and state[1][i] are the ith lane's inputs @math{x[n-1]} and @math{x[n-2]}, and 
+     * state[2][i] and state[3][i] its outputs @math{y[n-1]} and @math{y[n-2]}.
+     */
+    int32_t state[4][XS3_FILTER_CROSSOVER_LANES];
+
+    /** Coefficients. coef[j][i] is for the ith lane, with j mapping to b0, b1, b2, -a1 and -a2. */
+    int32_t coef[5][XS3_FILTER_CROSSOVER_LANES];
+} xs3_filter_crossover_s32_t;
+
+
+/**
+ * @brief Initialize a 32-bit Linkwitz-Riley crossover network.
+ * 
+ * The crossover frequencies are given by their prewarped gains @math{K_j = tan(\pi f_j / f_s)}, in ascending order of
+ * frequency. The LR4 lowpass, highpass and allpass coefficients are derived from these without floating-point 
+ * arithmetic, and the filter state is cleared.
+ * 
+ * Each @math{K_j} must be positive and less than @math{1} (i.e. @math{f_j < f_s/4}). Coefficient precision degrades 
+ * for very low crossover frequencies, as with any direct-form biquad.
+ * 
+ * @param[out]  xover       Crossover to be initialized
+ * @param[in]   band_count  Number of bands, from 2 to `XS3_FILTER_CROSSOVER_MAX_BANDS`
+ * @param[in]   K_q30       The `band_count - 1` prewarped crossover gains @math{K_j}, Q2.30, ascending
+ * 
+ * @see xs3_filter_crossover_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_crossover_s32_init(
+    xs3_filter_crossover_s32_t* xover,
+    const unsigned band_count,
+    const fixed_s32_t K_q30[]);
+
+
+/**
+ * @brief Split a block of samples into bands with a 32-bit Linkwitz-Riley crossover network.
+ * 
+ * Each of the `length` samples of `input[]` is processed by `xover`. The outputs are planar: band @math{b} (lowest
+ * band first) is written to `bands[b*length]` through `bands[b*length + length - 1]`.
+ * 
+ * Processing a signal in several blocks gives exactly the same output as processing it in one block.
+ * 
+ * @param[inout]    xover       Crossover to be processed
+ * @param[out]      bands       Band outputs, `xover->band_count * length` elements
+ * @param[in]       input       Input samples
+ * @param[in]       length      Number of samples to process
+ * 
+ * @see xs3_filter_crossover_s32_t
+ * 
+ * @ingroup xs3_filter_func
+ */
+C_API
+void xs3_filter_crossover_s32(
+    xs3_filter_crossover_s32_t* xover,
+    int32_t bands[],
+    const int32_t input[],
+    const unsigned length);
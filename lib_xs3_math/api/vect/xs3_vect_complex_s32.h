@@ -1832,6 +1832,323 @@ headroom_t xs3_vect_complex_s32_conjugate(
     const unsigned length);
 
 
+/**
+ * @brief Calculate the headroom of a planar complex 32-bit array.
+ * 
+ * A planar complex vector stores the real parts of its elements in one array, `x_real[]`, and the
+ * imaginary parts in another, `x_imag[]` (see @ref bfp_complex_s32_planar_t). The headroom of the
+ * vector is the smaller of the headrooms of the two arrays.
+ * 
+ * @param[in]   x_real  Real parts of complex input vector @vector{x}
+ * @param[in]   x_imag  Imaginary parts of complex input vector @vector{x}
+ * @param[in]   length  Number of elements in @vector{x}
+ * 
+ * @returns     Headroom of the vector @vector{x}
+ * 
+ * @exception ET_LOAD_STORE Raised if `x_real` or `x_imag` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_complex_s32_headroom
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_planar_headroom(
+    const int32_t x_real[],
+    const int32_t x_imag[],
+    const unsigned length);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit vector element-wise by another.
+ * 
+ * This is the planar counterpart of xs3_vect_complex_s32_mul(). The real and imaginary parts of each
+ * vector are held in separate arrays, so that each of the four partial products is a plain real
+ * element-wise multiplication over contiguous words. The output is identical to that of
+ * xs3_vect_complex_s32_mul() given the same inputs.
+ * 
+ * Each array must begin at a word-aligned address. This operation can be performed safely in-place on 
+ * @vector{b} or @vector{c}.
+ * 
+ * @operation{ 
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                     \\
+ * &     c_k' \leftarrow sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)                     \\
+ * &     Re\\{a_k\\} \leftarrow \left( Re\\{b_k'\\} \cdot Re\\{c_k'\\} 
+ *                                   - Im\\{b_k'\\} \cdot Im\\{c_k'\\} \right) \cdot 2^{-30} \\
+ * &     Im\\{a_k\\} \leftarrow \left( Re\\{b_k'\\} \cdot Im\\{c_k'\\} 
+ *                                   + Im\\{b_k'\\} \cdot Re\\{c_k'\\} \right) \cdot 2^{-30} \\
+ * &     \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * The function xs3_vect_complex_s32_mul_prepare() is used to obtain the output exponent and the shifts 
+ * `b_shr` and `c_shr`.
+ * 
+ * @param[out]      a_real      Real parts of complex output vector @vector{a}
+ * @param[out]      a_imag      Imaginary parts of complex output vector @vector{a}
+ * @param[in]       b_real      Real parts of complex input vector @vector{b}
+ * @param[in]       b_imag      Imaginary parts of complex input vector @vector{b}
+ * @param[in]       c_real      Real parts of complex input vector @vector{c}
+ * @param[in]       c_imag      Imaginary parts of complex input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift applied to elements of @vector{b}
+ * @param[in]       c_shr       Right-shift applied to elements of @vector{c}
+ * 
+ * @return      Headroom of the output vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if any of the arrays is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_complex_s32_mul_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_planar_mul(
+    int32_t a_real[],
+    int32_t a_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit vector element-wise by the complex conjugate of another.
+ * 
+ * This is the planar counterpart of xs3_vect_complex_s32_conj_mul(), and its output is identical to that
+ * function's given the same inputs.
+ * 
+ * Each array must begin at a word-aligned address. This operation can be performed safely in-place on 
+ * @vector{b} or @vector{c}.
+ * 
+ * @operation{ 
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                     \\
+ * &     c_k' \leftarrow sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)                     \\
+ * &     Re\\{a_k\\} \leftarrow \left( Re\\{b_k'\\} \cdot Re\\{c_k'\\} 
+ *                                   + Im\\{b_k'\\} \cdot Im\\{c_k'\\} \right) \cdot 2^{-30} \\
+ * &     Im\\{a_k\\} \leftarrow \left( Im\\{b_k'\\} \cdot Re\\{c_k'\\} 
+ *                                   - Re\\{b_k'\\} \cdot Im\\{c_k'\\} \right) \cdot 2^{-30} \\
+ * &     \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * The function xs3_vect_complex_s32_conj_mul_prepare() is used to obtain the output exponent and the 
+ * shifts `b_shr` and `c_shr`.
+ * 
+ * @param[out]      a_real      Real parts of complex output vector @vector{a}
+ * @param[out]      a_imag      Imaginary parts of complex output vector @vector{a}
+ * @param[in]       b_real      Real parts of complex input vector @vector{b}
+ * @param[in]       b_imag      Imaginary parts of complex input vector @vector{b}
+ * @param[in]       c_real      Real parts of complex input vector @vector{c}
+ * @param[in]       c_imag      Imaginary parts of complex input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift applied to elements of @vector{b}
+ * @param[in]       c_shr       Right-shift applied to elements of @vector{c}
+ * 
+ * @return      Headroom of the output vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if any of the arrays is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_complex_s32_conj_mul_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_planar_conj_mul(
+    int32_t a_real[],
+    int32_t a_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Multiply one planar complex 32-bit vector element-wise by another, and add the result to an
+ * accumulator vector.
+ * 
+ * This is the planar counterpart of xs3_vect_complex_s32_macc(), and its output is identical to that 
+ * function's given the same inputs.
+ * 
+ * Each array must begin at a word-aligned address.
+ * 
+ * @operation{ 
+ * &     v_k \leftarrow round( sat_{32}( b_k \cdot 2^{-b\_shr} ) \cdot sat_{32}( c_k \cdot 2^{-c\_shr} ) 
+ *                            \cdot 2^{-30} ) \\
+ * &     a_k \leftarrow sat_{32}( v_k + a_k \cdot 2^{-acc\_shr} ) \\
+ * &     \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * The function xs3_vect_complex_s32_macc_prepare() is used to obtain the new accumulator exponent and 
+ * the shifts `acc_shr`, `b_shr` and `c_shr`.
+ * 
+ * @param[inout]    acc_real    Real parts of complex accumulator vector @vector{a}
+ * @param[inout]    acc_imag    Imaginary parts of complex accumulator vector @vector{a}
+ * @param[in]       b_real      Real parts of complex input vector @vector{b}
+ * @param[in]       b_imag      Imaginary parts of complex input vector @vector{b}
+ * @param[in]       c_real      Real parts of complex input vector @vector{c}
+ * @param[in]       c_imag      Imaginary parts of complex input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       acc_shr     Signed arithmetic right-shift applied to accumulator elements
+ * @param[in]       b_shr       Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]       c_shr       Signed arithmetic right-shift applied to elements of @vector{c}
+ * 
+ * @return      Headroom of the accumulator vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if any of the arrays is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_complex_s32_macc_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_planar_macc(
+    int32_t acc_real[],
+    int32_t acc_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Compute the magnitude of each element of a planar complex 32-bit vector.
+ * 
+ * This is the planar counterpart of xs3_vect_complex_s32_mag(), and its output is identical to that 
+ * function's given the same inputs. See xs3_vect_complex_s32_mag() for a description of `rot_table` and
+ * `table_rows`.
+ * 
+ * Each array must begin at a word-aligned address.
+ * 
+ * @operation{ 
+ * &     v_k \leftarrow b_k \cdot 2^{-b\_shr}    \\
+ * &     a_k \leftarrow \sqrt { {\left( Re\\{v_k\\} \right)}^2 + {\left( Im\\{v_k\\} \right)}^2 }
+ * &       \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * The function xs3_vect_complex_s32_mag_prepare() is used to obtain the output exponent and `b_shr`.
+ * 
+ * @param[out]  a           Real output vector @vector{a}
+ * @param[in]   b_real      Real parts of complex input vector @vector{b}
+ * @param[in]   b_imag      Imaginary parts of complex input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b}
+ * @param[in]   rot_table   Pre-computed rotation table required for calculating magnitudes
+ * @param[in]   table_rows  Number of rows in `rot_table`
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @exception ET_LOAD_STORE Raised if any of the arrays is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_complex_s32_mag_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_planar_mag(
+    int32_t a[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows);
+
+
+/**
+ * @brief Update an exponentially smoothed cross-power spectrum with one frame.
+ *
+ * This computes @math{ a_k \leftarrow \alpha a_k + (1-\alpha) b_k c_k^* } in a single pass. That is
+ * the update used to track e.g. the spatial covariance between two channels' spectra @vector{b}
+ * and @vector{c}. It replaces a conjugate multiply, a scale and an add, along with the temporary
+ * vector between them.
+ *
+ * `acc[]` represents the complex 32-bit accumulator mantissa vector @vector{a}. `b[]` and `c[]`
+ * represent the complex 32-bit input mantissa vectors @vector{b} and @vector{c}. Each must begin at
+ * a word-aligned address.
+ *
+ * `length` is the number of elements in each of the vectors.
+ *
+ * `alpha_q30` is the smoothing coefficient @math{\alpha} in Q30 format. It must be in the range
+ * @math{0 \leq \alpha \leq 1} (i.e. `0` to `0x40000000`).
+ *
+ * `acc_shr`, `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to input elements
+ * @math{a_k}, @math{b_k} and @math{c_k}.
+ *
+ * @operation{
+ * &     \tilde{b}_k \leftarrow sat_{32}( b_k \cdot 2^{-b\_shr} )               \\
+ * &     \tilde{c}_k \leftarrow sat_{32}( c_k \cdot 2^{-c\_shr} )               \\
+ * &     \tilde{a}_k \leftarrow sat_{32}( a_k \cdot 2^{-acc\_shr} )             \\
+ * &     p_k \leftarrow sat_{32}( round( \tilde{b}_k \cdot \tilde{c}_k^* \cdot 2^{-30} ) ) \\
+ * &     a_k \leftarrow sat_{32}( round( \alpha \cdot \tilde{a}_k + (1 - \alpha) \cdot p_k ) ) \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ *
+ * @par Block Floating-Point
+ * @parblock
+ *
+ * If inputs @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot
+ * 2^{b\_exp} } and @math{\bar{c} \cdot 2^{c\_exp}}, and input @vector{a} is the accumulator BFP
+ * vector @math{\bar{a} \cdot 2^{a\_exp}}, then the output values of @vector{a} have the exponent
+ * @math{2^{a\_exp + acc\_shr}}.
+ *
+ * The shifts and output exponent are the same as for xs3_vect_complex_s32_conj_macc(), so 
+ * xs3_vect_complex_s32_conj_macc_ema_prepare() (an alias of xs3_vect_complex_s32_macc_prepare()) 
+ * can be used to obtain them.
+ * @endparblock
+ *
+ * @param[inout]  acc       Complex accumulator @vector{a}
+ * @param[in]     b         Complex input vector @vector{b}
+ * @param[in]     c         Complex input vector @vector{c}
+ * @param[in]     length    Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]     alpha_q30 Smoothing coefficient @math{\alpha} in Q30 format
+ * @param[in]     acc_shr   Signed arithmetic right-shift applied to accumulator elements.
+ * @param[in]     b_shr     Signed arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]     c_shr     Signed arithmetic right-shift applied to elements of @vector{c}
+ * 
+ * @returns   Headroom of the output vector @vector{a}
+ *
+ * @exception ET_LOAD_STORE Raised if `acc`, `b` or `c` is not word-aligned (See @ref note_vector_alignment)
+ *
+ * @see xs3_vect_complex_s32_conj_macc_ema_prepare
+ *
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_complex_s32_conj_macc_ema(
+    complex_s32_t acc[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const fixed_s32_t alpha_q30,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shifts required for a call to 
+ * xs3_vect_complex_s32_conj_macc_ema().
+ *
+ * The logic for computing the shifts and exponents of `xs3_vect_complex_s32_conj_macc_ema()` is 
+ * identical to that for `xs3_vect_complex_s32_macc_prepare()`.
+ *
+ * This macro is provided as a convenience to developers and to make the code more readable.
+ *
+ * @see xs3_vect_complex_s32_macc_prepare(), xs3_vect_complex_s32_conj_macc_ema()
+ *
+ * @ingroup xs3_vect32_prepare
+ */
+#define xs3_vect_complex_s32_conj_macc_ema_prepare xs3_vect_complex_s32_macc_prepare
+
+
 #ifdef __XC__
 }   //extern "C"
 #endif
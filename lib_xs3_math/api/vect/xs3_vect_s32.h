@@ -2214,6 +2214,1372 @@ void xs3_vect_s32_split_accs(
     const unsigned length);
 
 
+/**
+ * @brief Compute a Wiener noise-suppression gain from signal and noise power vectors.
+ * 
+ * `a[]` is the output gain vector @vector{a}. The output gains are encoded as Q2.30 values, and
+ * lie in the range @math{[gain\_min \cdot 2^{-30}, 1]}.
+ * 
+ * `sig_pow[]` and `noise_pow[]` are the mantissa vectors @vector{s} and @vector{n} of the
+ * (noisy) signal power and noise power estimates respectively. Negative power values are treated
+ * as @math{0}.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `sig_shr` and `noise_shr` are the signed arithmetic right-shifts applied to the elements of 
+ * @vector{s} and @vector{n} to bring them to a common exponent.
+ * 
+ * `gain_min` is the Q2.30 gain floor @math{g_{min}}.
+ * 
+ * Gains are computed from the maximum-likelihood a priori SNR estimate 
+ * @math{\xi_k = s_k/n_k - 1} in a single pass, without explicitly computing the SNR.
+ * 
+ * @operation{
+ * &     s_k' \leftarrow s_k \cdot 2^{-sig\_shr}                           \\
+ * &     n_k' \leftarrow n_k \cdot 2^{-noise\_shr}                         \\
+ * &     a_k \leftarrow max\!\left\\{ g_{min}, 
+ *                  \frac{max\\{s_k' - n_k', 0\\}}{max\\{s_k' - n_k', 0\\} + n_k'} \cdot 2^{30} \right\\}  \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{s} and @vector{n} are the mantissas of BFP vectors @math{\bar{s} \cdot 2^{s\_exp}} 
+ * and @math{\bar{n} \cdot 2^{n\_exp}}, then the resulting vector @vector{a} are the mantissas of
+ * the gain vector @math{\bar{a} \cdot 2^{-30}}.
+ * 
+ * The function xs3_vect_s32_wiener_gain_prepare() can be used to obtain values for `sig_shr` and
+ * `noise_shr`.
+ * @endparblock
+ * 
+ * @param[out]  a           Output gain vector @vector{a}
+ * @param[in]   sig_pow     Signal power vector @vector{s}
+ * @param[in]   noise_pow   Noise power vector @vector{n}
+ * @param[in]   length      Number of elements in vectors @vector{a}, @vector{s} and @vector{n}
+ * @param[in]   sig_shr     Signed arithmetic right-shift applied to elements of @vector{s}
+ * @param[in]   noise_shr   Signed arithmetic right-shift applied to elements of @vector{n}
+ * @param[in]   gain_min    Minimum output gain @math{g_{min}} (Q2.30)
+ * 
+ * @returns     Headroom of output vector @vector{a}
+ * 
+ * @see xs3_vect_s32_wiener_gain_prepare,
+ *      xs3_vect_s32_wiener_gain_dd
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_wiener_gain(
+    int32_t a[],
+    const int32_t sig_pow[],
+    const int32_t noise_pow[],
+    const unsigned length,
+    const right_shift_t sig_shr,
+    const right_shift_t noise_shr,
+    const int32_t gain_min);
+
+
+/**
+ * @brief Obtain the shift parameters required by xs3_vect_s32_wiener_gain().
+ * 
+ * The signal and noise power vectors are brought to a common exponent, the smallest exponent
+ * which can represent both of them without saturation.
+ * 
+ * @param[out]  sig_shr     Signed arithmetic right-shift to be applied to signal power mantissas
+ * @param[out]  noise_shr   Signed arithmetic right-shift to be applied to noise power mantissas
+ * @param[in]   sig_exp     Exponent of signal power vector
+ * @param[in]   noise_exp   Exponent of noise power vector
+ * @param[in]   sig_hr      Headroom of signal power vector
+ * @param[in]   noise_hr    Headroom of noise power vector
+ * 
+ * @see xs3_vect_s32_wiener_gain
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_wiener_gain_prepare(
+    right_shift_t* sig_shr,
+    right_shift_t* noise_shr,
+    const exponent_t sig_exp,
+    const exponent_t noise_exp,
+    const headroom_t sig_hr,
+    const headroom_t noise_hr);
+
+
+/**
+ * @brief Compute a decision-directed Wiener noise-suppression gain.
+ * 
+ * This is the decision-directed variant of xs3_vect_s32_wiener_gain(). The a priori SNR is 
+ * estimated from a weighted combination of the previous frame's clean signal power estimate 
+ * @vector{p} and the maximum-likelihood estimate of the current frame. The clean signal power
+ * estimate is then updated in-place for use with the next frame.
+ * 
+ * `a[]` is the output gain vector @vector{a}, encoded as Q2.30 values.
+ * 
+ * `clean_pow[]` is the clean signal power estimate @vector{p}. On input it holds the estimate
+ * from the previous frame, and on output it holds the estimate for the current frame. 
+ * 
+ * `clean_hr` is the output headroom of the updated @vector{p}.
+ * 
+ * `sig_pow[]` and `noise_pow[]` are the mantissa vectors @vector{s} and @vector{n} of the
+ * (noisy) signal power and noise power estimates respectively.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `clean_shr`, `sig_shr` and `noise_shr` are the signed arithmetic right-shifts applied to the
+ * elements of @vector{p}, @vector{s} and @vector{n} to bring them to a common exponent.
+ * 
+ * `alpha` is the Q2.30 smoothing factor @math{\alpha}, which must be in the range 
+ * @math{[0, 2^{30}]}. Typical values are around @math{0.98}.
+ * 
+ * `gain_min` is the Q2.30 gain floor @math{g_{min}}.
+ * 
+ * @operation{
+ * &     p_k' \leftarrow p_k \cdot 2^{-clean\_shr}                                         \\
+ * &     s_k' \leftarrow s_k \cdot 2^{-sig\_shr}                                           \\
+ * &     n_k' \leftarrow n_k \cdot 2^{-noise\_shr}                                         \\
+ * &     v_k \leftarrow \alpha \cdot p_k' + (1 - \alpha) \cdot max\\{s_k' - n_k', 0\\}      \\
+ * &     a_k \leftarrow max\!\left\\{ g_{min}, \frac{v_k}{v_k + n_k'} \cdot 2^{30} \right\\} \\
+ * &     p_k \leftarrow (a_k \cdot 2^{-30})^2 \cdot s_k'                                   \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * The output gains @vector{a} have an exponent of @math{-30}. The updated clean power estimate
+ * @vector{p} takes the common exponent chosen by xs3_vect_s32_wiener_gain_dd_prepare(), which can
+ * also be used to obtain values for `clean_shr`, `sig_shr` and `noise_shr`.
+ * @endparblock
+ * 
+ * @param[out]      a           Output gain vector @vector{a}
+ * @param[inout]    clean_pow   Clean signal power estimate @vector{p}
+ * @param[out]      clean_hr    Headroom of updated @vector{p}
+ * @param[in]       sig_pow     Signal power vector @vector{s}
+ * @param[in]       noise_pow   Noise power vector @vector{n}
+ * @param[in]       length      Number of elements in each vector
+ * @param[in]       clean_shr   Signed arithmetic right-shift applied to elements of @vector{p}
+ * @param[in]       sig_shr     Signed arithmetic right-shift applied to elements of @vector{s}
+ * @param[in]       noise_shr   Signed arithmetic right-shift applied to elements of @vector{n}
+ * @param[in]       alpha       Smoothing factor @math{\alpha} (Q2.30)
+ * @param[in]       gain_min    Minimum output gain @math{g_{min}} (Q2.30)
+ * 
+ * @returns     Headroom of output vector @vector{a}
+ * 
+ * @see xs3_vect_s32_wiener_gain_dd_prepare,
+ *      xs3_vect_s32_wiener_gain
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_wiener_gain_dd(
+    int32_t a[],
+    int32_t clean_pow[],
+    headroom_t* clean_hr,
+    const int32_t sig_pow[],
+    const int32_t noise_pow[],
+    const unsigned length,
+    const right_shift_t clean_shr,
+    const right_shift_t sig_shr,
+    const right_shift_t noise_shr,
+    const int32_t alpha,
+    const int32_t gain_min);
+
+
+/**
+ * @brief Obtain the output exponent and shift parameters required by 
+ * xs3_vect_s32_wiener_gain_dd().
+ * 
+ * The clean, signal and noise power vectors are brought to a common exponent, the smallest
+ * exponent which can represent all of them without saturation. This common exponent is output as
+ * `a_clean_exp`, the exponent of the updated clean power estimate. If the clean power estimate is
+ * all zeros (`clean_hr` is @math{31} or more), it does not influence the common exponent.
+ * 
+ * @param[out]  a_clean_exp Exponent of the updated clean power estimate
+ * @param[out]  clean_shr   Signed arithmetic right-shift to be applied to clean power mantissas
+ * @param[out]  sig_shr     Signed arithmetic right-shift to be applied to signal power mantissas
+ * @param[out]  noise_shr   Signed arithmetic right-shift to be applied to noise power mantissas
+ * @param[in]   clean_exp   Exponent of clean power estimate (previous frame)
+ * @param[in]   sig_exp     Exponent of signal power vector
+ * @param[in]   noise_exp   Exponent of noise power vector
+ * @param[in]   clean_hr    Headroom of clean power estimate (previous frame)
+ * @param[in]   sig_hr      Headroom of signal power vector
+ * @param[in]   noise_hr    Headroom of noise power vector
+ * 
+ * @see xs3_vect_s32_wiener_gain_dd
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_wiener_gain_dd_prepare(
+    exponent_t* a_clean_exp,
+    right_shift_t* clean_shr,
+    right_shift_t* sig_shr,
+    right_shift_t* noise_shr,
+    const exponent_t clean_exp,
+    const exponent_t sig_exp,
+    const exponent_t noise_exp,
+    const headroom_t clean_hr,
+    const headroom_t sig_hr,
+    const headroom_t noise_hr);
+
+
+/**
+ * @brief Compute the element-wise maximum of two 32-bit vectors.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 32-bit mantissa vectors @vector{a}, @vector{b} and @vector{c} respectively. 
+ * Each must begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c} 
+ * respectively.
+ * 
+ * @operation{ 
+ * &     b_k' = sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)  \\
+ * &     c_k' = sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)  \\
+ * &     a_k \leftarrow max\\{ b_k', c_k' \\}                      \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector 
+ * @math{\bar{a} \cdot 2^{a\_exp}}. 
+ * 
+ * In this case, @math{b\_shr} and @math{c\_shr} **must** be chosen so that 
+ * @math{a\_exp = b\_exp + b\_shr = c\_exp + c\_shr}. Comparing mantissas only makes sense if they are associated
+ * with the same exponent.
+ * 
+ * The function xs3_vect_s32_max_elementwise_prepare() can be used to obtain values for @math{a\_exp}, 
+ * @math{b\_shr} and @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input 
+ * headrooms @math{b\_hr} and @math{c\_hr}.
+ * @endparblock
+ * 
+ * @param[out]      a           Output vector @vector{a}
+ * @param[in]       b           Input vector @vector{b}
+ * @param[in]       c           Input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift appled to @vector{b}
+ * @param[in]       c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @see xs3_vect_s32_max_elementwise_prepare,
+ *      xs3_vect_s32_min_elementwise,
+ *      xs3_vect_s32_max
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_max_elementwise(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Compute the element-wise minimum of two 32-bit vectors.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 32-bit mantissa vectors @vector{a}, @vector{b} and @vector{c} respectively. 
+ * Each must begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c} 
+ * respectively.
+ * 
+ * @operation{ 
+ * &     b_k' = sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)  \\
+ * &     c_k' = sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)  \\
+ * &     a_k \leftarrow min\\{ b_k', c_k' \\}                      \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector 
+ * @math{\bar{a} \cdot 2^{a\_exp}}. 
+ * 
+ * In this case, @math{b\_shr} and @math{c\_shr} **must** be chosen so that 
+ * @math{a\_exp = b\_exp + b\_shr = c\_exp + c\_shr}.
+ * 
+ * The function xs3_vect_s32_min_elementwise_prepare() can be used to obtain values for @math{a\_exp}, 
+ * @math{b\_shr} and @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input 
+ * headrooms @math{b\_hr} and @math{c\_hr}.
+ * @endparblock
+ * 
+ * @param[out]      a           Output vector @vector{a}
+ * @param[in]       b           Input vector @vector{b}
+ * @param[in]       c           Input vector @vector{c}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b} and @vector{c}
+ * @param[in]       b_shr       Right-shift appled to @vector{b}
+ * @param[in]       c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @see xs3_vect_s32_min_elementwise_prepare,
+ *      xs3_vect_s32_max_elementwise,
+ *      xs3_vect_s32_min
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_min_elementwise(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Select elements from one of two 32-bit vectors according to a mask.
+ * 
+ * `a[]`, `b[]` and `c[]` represent the 32-bit mantissa vectors @vector{a}, @vector{b} and @vector{c} respectively. 
+ * Each must begin at a word-aligned address. This operation can be performed safely in-place on `b[]` or `c[]`.
+ * 
+ * `mask[]` is the 8-bit selection vector @vector{m}. Where @math{m_k} is non-zero, the output element is taken from
+ * @vector{b}, otherwise it is taken from @vector{c}. Masks of this form are produced by, for example, 
+ * xs3_vect_s8_is_negative().
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` and `c_shr` are the signed arithmetic right-shifts applied to each element of @vector{b} and @vector{c} 
+ * respectively.
+ * 
+ * @operation{ 
+ * &     b_k' = sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)  \\
+ * &     c_k' = sat_{32}(\lfloor c_k \cdot 2^{-c\_shr} \rfloor)  \\
+ * &     a_k \leftarrow \begin{cases}
+ *          b_k' & m_k \neq 0 \\
+ *          c_k' & otherwise \end{cases}                          \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1) 
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} and @vector{c} are the mantissas of BFP vectors @math{ \bar{b} \cdot 2^{b\_exp} } and 
+ * @math{\bar{c} \cdot 2^{c\_exp}}, then the resulting vector @vector{a} are the mantissas of BFP vector 
+ * @math{\bar{a} \cdot 2^{a\_exp}}. 
+ * 
+ * In this case, @math{b\_shr} and @math{c\_shr} **must** be chosen so that 
+ * @math{a\_exp = b\_exp + b\_shr = c\_exp + c\_shr}.
+ * 
+ * The function xs3_vect_s32_select_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr} and 
+ * @math{c\_shr} based on the input exponents @math{b\_exp} and @math{c\_exp} and the input headrooms @math{b\_hr} 
+ * and @math{c\_hr}.
+ * @endparblock
+ * 
+ * @param[out]      a           Output vector @vector{a}
+ * @param[in]       b           Input vector @vector{b}
+ * @param[in]       c           Input vector @vector{c}
+ * @param[in]       mask        Selection vector @vector{m}
+ * @param[in]       length      Number of elements in vectors @vector{a}, @vector{b}, @vector{c} and @vector{m}
+ * @param[in]       b_shr       Right-shift appled to @vector{b}
+ * @param[in]       c_shr       Right-shift appled to @vector{c}
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @see xs3_vect_s32_select_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_select(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const int8_t mask[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr);
+
+
+/**
+ * @brief Obtain the output exponent and input shifts required for a call to 
+ * xs3_vect_s32_max_elementwise().
+ * 
+ * Each output element is one of the (shifted) input elements, so unlike xs3_vect_s32_add_prepare() no 
+ * additional bit of headroom is reserved for growth. The output exponent @math{a\_exp} is the smallest exponent 
+ * which can represent every element of both @vector{b} and @vector{c} without saturation.
+ * 
+ * @param[out]  a_exp       Output exponent associated with output mantissa vector @vector{a}
+ * @param[out]  b_shr       Signed arithmetic right-shift to be applied to elements of @vector{b}
+ * @param[out]  c_shr       Signed arithmetic right-shift to be applied to elements of @vector{c}
+ * @param[in]   b_exp       Exponent of BFP input vector @vector{b}
+ * @param[in]   c_exp       Exponent of BFP input vector @vector{c}
+ * @param[in]   b_hr        Headroom of BFP input vector @vector{b}
+ * @param[in]   c_hr        Headroom of BFP input vector @vector{c}
+ * 
+ * @see xs3_vect_s32_max_elementwise
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_max_elementwise_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t b_hr,
+    const headroom_t c_hr);
+
+
+/**
+ * @brief Obtain the output exponent and input shifts required for a call to 
+ * xs3_vect_s32_min_elementwise().
+ * 
+ * The logic for computing the shifts and exponents of `xs3_vect_s32_min_elementwise()` is identical to that for
+ * `xs3_vect_s32_max_elementwise()`.
+ * 
+ * This macro is provided as a convenience to developers and to make the code more readable.
+ * 
+ * @see xs3_vect_s32_max_elementwise_prepare()
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+#define xs3_vect_s32_min_elementwise_prepare xs3_vect_s32_max_elementwise_prepare
+
+
+/**
+ * @brief Obtain the output exponent and input shifts required for a call to xs3_vect_s32_select().
+ * 
+ * The logic for computing the shifts and exponents of `xs3_vect_s32_select()` is identical to that for
+ * `xs3_vect_s32_max_elementwise()`.
+ * 
+ * This macro is provided as a convenience to developers and to make the code more readable.
+ * 
+ * @see xs3_vect_s32_max_elementwise_prepare()
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+#define xs3_vect_s32_select_prepare xs3_vect_s32_max_elementwise_prepare
+
+
+/**
+ * @brief Find the maximum absolute value and the energy of a 32-bit vector in a single pass.
+ * 
+ * This function computes the same results as xs3_vect_s32_abs() followed by xs3_vect_s32_max() together with
+ * xs3_vect_s32_energy(), but reads the input vector only once and does not modify it. This is useful for level 
+ * metering, where both the peak and the RMS level of each channel are required.
+ * 
+ * `b[]` represents the 32-bit mantissa vector @vector{b}. `b[]` must begin at a word-aligned address.
+ * 
+ * `energy` points to the output 64-bit energy mantissa @math{e}.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b} when computing the energy. It is not
+ * applied when computing the maximum absolute value.
+ * 
+ * @operation{
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                 \\
+ * &     e \leftarrow \sum_{k=0}^{length-1} round((b_k')^2 \cdot 2^{-30})               \\
+ * &     a \leftarrow max\\{ sat_{32}(\left| b_0 \right|), ..., sat_{32}(\left| b_{length-1} \right|) \\}
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the returned value 
+ * @math{a} is the mantissa of the maximum absolute value @math{a \cdot 2^{b\_exp}}, and the energy is 
+ * @math{e \cdot 2^{e\_exp}}, where @math{e\_exp = 30 + 2 \cdot (b\_exp + b\_shr)}.
+ * 
+ * The function xs3_vect_s32_energy_prepare() can be used to obtain values for @math{e\_exp} and @math{b\_shr}. The 
+ * same restrictions on `length` described for xs3_vect_s32_energy() apply.
+ * @endparblock
+ * 
+ * @param[out]  energy      Output energy mantissa @math{e}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b} for the energy computation
+ * 
+ * @returns     Maximum absolute value of the elements of @vector{b}
+ * 
+ * @see xs3_vect_s32_energy_prepare,
+ *      xs3_vect_s32_energy,
+ *      xs3_vect_s32_max
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+int32_t xs3_vect_s32_abs_max_energy(
+    int64_t* energy,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Compute several summary statistics of a 32-bit vector in a single pass.
+ * 
+ * This function computes the maximum and minimum elements (and their indices), the sum and the energy of 
+ * @vector{b}, reading each element once. The results are the same as those of xs3_vect_s32_max(), 
+ * xs3_vect_s32_min(), xs3_vect_s32_argmax(), xs3_vect_s32_argmin(), xs3_vect_s32_sum() and 
+ * xs3_vect_s32_energy() respectively. In particular the sum is accumulated with the same 40-bit saturation as 
+ * xs3_vect_s32_sum().
+ * 
+ * `a` points to the output statistics.
+ * 
+ * `b[]` represents the 32-bit mantissa vector @vector{b}. `b[]` must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b} when computing the energy only.
+ * 
+ * @operation{
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                 \\
+ * &     a.max \leftarrow max\\{ b_0, ..., b_{length-1} \\}                               \\
+ * &     a.min \leftarrow min\\{ b_0, ..., b_{length-1} \\}                               \\
+ * &     a.argmax \leftarrow argmax_k\\{ b_k \\}                                          \\
+ * &     a.argmin \leftarrow argmin_k\\{ b_k \\}                                          \\
+ * &     a.sum \leftarrow \sum_{k=0}^{length-1} b_k                                      \\
+ * &     a.energy \leftarrow \sum_{k=0}^{length-1} round((b_k')^2 \cdot 2^{-30})
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then `max`, `min` and `sum` 
+ * have exponent @math{b\_exp}, and `energy` has exponent @math{30 + 2 \cdot (b\_exp + b\_shr)}.
+ * 
+ * The function xs3_vect_s32_energy_prepare() can be used to obtain a value for @math{b\_shr}. The restrictions on 
+ * `length` described for xs3_vect_s32_sum() and xs3_vect_s32_energy() apply to the sum and energy respectively.
+ * @endparblock
+ * 
+ * @param[out]  a           Output statistics
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   b_shr       Right-shift appled to @vector{b} for the energy computation
+ * 
+ * @see xs3_vect_s32_stats_t,
+ *      xs3_vect_s32_energy_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+void xs3_vect_s32_stats(
+    xs3_vect_s32_stats_t* a,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Compute the first and second moments of a 32-bit vector about a pivot.
+ * 
+ * This function computes, in a single pass, the sum and the sum of squares of the differences between the elements
+ * of @vector{b} and a pivot value @math{p}. These can be used to compute the mean and variance of @vector{b}. 
+ * Taking the differences relative to a pivot close to the mean (for example, any element of @vector{b}) avoids the
+ * catastrophic cancellation which would otherwise occur when the mean of @vector{b} is large compared to its spread.
+ * 
+ * `sum` and `sum_sq` point to the 64-bit outputs @math{s_1} and @math{s_2}.
+ * 
+ * `b[]` represents the 32-bit mantissa vector @vector{b}. `b[]` must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `pivot` is the pivot value @math{p}, which has the same exponent as @vector{b}.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to the (64-bit) differences, with rounding. Both sums are computed exactly,
+ * provided `b_shr` is chosen such that neither overflows. xs3_vect_s32_moments_prepare() gives a suitable value.
+ * 
+ * @operation{
+ * &     d_k \leftarrow round((b_k - p) \cdot 2^{-b\_shr})                              \\
+ * &     s_1 \leftarrow \sum_{k=0}^{length-1} d_k                                        \\
+ * &     s_2 \leftarrow \sum_{k=0}^{length-1} d_k^2
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then @math{s_1} has 
+ * exponent @math{d\_exp = b\_exp + b\_shr} and @math{s_2} has exponent @math{2 \cdot d\_exp}. The (population) 
+ * variance of @math{\bar{b}} is then @math{\left(s_2 - s_1^2 / length\right) / length \cdot 2^{2 \cdot d\_exp}}.
+ * @endparblock
+ * 
+ * @param[out]  sum         Output sum of differences @math{s_1}
+ * @param[out]  sum_sq      Output sum of squared differences @math{s_2}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   pivot       Pivot value @math{p}
+ * @param[in]   b_shr       Right-shift applied to the differences
+ * 
+ * @see xs3_vect_s32_moments_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+void xs3_vect_s32_moments(
+    int64_t* sum,
+    int64_t* sum_sq,
+    const int32_t b[],
+    const unsigned length,
+    const int32_t pivot,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Obtain the difference exponent and shift used by xs3_vect_s32_moments().
+ * 
+ * `b_shr` is chosen so that, when the pivot is an element of @vector{b}, the sums computed by 
+ * xs3_vect_s32_moments() cannot overflow, while retaining as much precision as possible. `a_exp` is the 
+ * exponent @math{d\_exp} associated with the shifted differences (and with the first moment).
+ * 
+ * @param[out]  a_exp       Exponent @math{d\_exp} of the shifted differences
+ * @param[out]  b_shr       Right-shift to be applied to the differences
+ * @param[in]   length      Number of elements in vector @vector{b}
+ * @param[in]   b_exp       Exponent of vector @vector{b}
+ * @param[in]   b_hr        Headroom of vector @vector{b}
+ * 
+ * @see xs3_vect_s32_moments
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_moments_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    const unsigned length,
+    const exponent_t b_exp,
+    const headroom_t b_hr);
+
+
+/**
+ * @brief Apply an affine transform (scale and offset) to a 32-bit vector.
+ * 
+ * `a[]` and `b[]` represent the 32-bit mantissa vectors @vector{a} and @vector{b} respectively. Each must begin at a
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `scale` is the 32-bit scale factor @math{s}, and `offset` is the 64-bit offset @math{o}, which is added to the 
+ * full 64-bit product of each element with @math{s}.
+ * 
+ * `a_shr` is the signed arithmetic right-shift applied to the 64-bit results, with rounding. The results are then
+ * saturated to 32 bits. @math{b_k \cdot s + o} must not overflow 64 bits.
+ * 
+ * This operation replaces an xs3_vect_s32_add_scalar() followed by an xs3_vect_s32_scale() with a single pass, 
+ * and the offset is applied without first being rounded to 32 bits.
+ * 
+ * @operation{
+ * &     a_k \leftarrow sat_{32}(round((b_k \cdot s + o) \cdot 2^{-a\_shr}))            \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, @math{s} is the mantissa of 
+ * @math{s \cdot 2^{s\_exp}} and @math{o} is a mantissa with exponent @math{b\_exp + s\_exp}, then the resulting 
+ * vector @vector{a} are the mantissas of @math{\bar{a} \cdot 2^{a\_exp}}, where 
+ * @math{a\_exp = b\_exp + s\_exp + a\_shr}.
+ * @endparblock
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   scale       Scale factor @math{s}
+ * @param[in]   offset      Offset @math{o}
+ * @param[in]   a_shr       Right-shift applied to the 64-bit results
+ * 
+ * @returns     Headroom of the output vector @vector{a}.
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_affine(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const int32_t scale,
+    const int64_t offset,
+    const right_shift_t a_shr);
+
+
+/**
+ * @brief Obtain the indices and values of the `K` largest elements of a 32-bit vector.
+ * 
+ * `b[]` represents the 32-bit input vector @vector{b}. It must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `K` is the number of elements to be selected. It must not exceed `length`.
+ * 
+ * `indices[]` is the output array of `K` indices into @vector{b}, in order of decreasing element value. If there
+ * is a tie in value, the lower index comes first (consistent with xs3_vect_s32_argmax()), so `indices[0]` is the 
+ * index that xs3_vect_s32_argmax() would return.
+ * 
+ * `values[]` is the output array of the `K` corresponding elements of @vector{b}. It may be `NULL` if the values 
+ * are not needed.
+ * 
+ * Only the `K` largest elements are ordered. The cost is a single comparison for each element of @vector{b} that
+ * does not exceed the smallest of the largest `K` elements found so far, plus @math{O(log K)} for each element 
+ * that does, so for @math{K \ll length} this is roughly @math{O(length)}. No scratch memory is needed.
+ * 
+ * @operation{
+ * &     i_0 \leftarrow argmax_k\\{ b_k \\}                                                  \\
+ * &     i_j \leftarrow argmax_k\\{ b_k \\} \text{ for } k \notin \\{ i_0, ..., i_{j-1} \\}  \\
+ * &     v_j \leftarrow b_{i_j}                                                             \\
+ * &         \qquad\text{ for }j\in 0\ ...\ (K-1)
+ * }
+ * 
+ * @param[out]  indices     Output indices @math{i_j}
+ * @param[out]  values      Output values @math{v_j}, or `NULL`
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   K           Number of elements to select
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+void xs3_vect_s32_topk(
+    unsigned indices[],
+    int32_t values[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned K);
+
+
+/**
+ * @brief Count the elements of a 32-bit vector falling in each of a set of equal-width bins.
+ * 
+ * `counts[]` is the output array of `bins` counts. Its previous contents are discarded.
+ * 
+ * `b[]` represents the 32-bit input vector @vector{b}. It must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `bins` is the number of bins, @math{J}. It must be non-zero.
+ * 
+ * `lower` is the lower bound @math{l} of the first bin, and `bin_shr` the base-2 logarithm of the width of each 
+ * bin, so bin @math{j} covers the values @math{[l + j \cdot 2^{bin\_shr}, l + (j+1) \cdot 2^{bin\_shr})}. Because 
+ * the bin widths are a power of 2, the bin of each element is found with a subtraction and a shift rather than a 
+ * division. `bin_shr` must not be negative.
+ * 
+ * Elements below the first bin are counted in the first bin, and elements beyond the last bin are counted in the
+ * last bin, so the counts always sum to `length`.
+ * 
+ * @operation{
+ * &     j_k \leftarrow min\left(max\left(\left\lfloor (b_k - l) \cdot 2^{-bin\_shr} \right\rfloor, 0\right), J-1\right)  \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)                                                     \\
+ * &     c_j \leftarrow \left| \\{ k : j_k = j \\} \right|                                                 \\
+ * &         \qquad\text{ for }j\in 0\ ...\ (J-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the bin edges are 
+ * @math{(l + j \cdot 2^{bin\_shr}) \cdot 2^{b\_exp}}. Mantissas can be binned directly because every element 
+ * shares the exponent.
+ * @endparblock
+ * 
+ * @param[out]  counts      Output bin counts @math{c_j}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   bins        Number of bins @math{J}
+ * @param[in]   lower       Lower bound @math{l} of the first bin
+ * @param[in]   bin_shr     Base-2 logarithm of the bin width
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+void xs3_vect_s32_histogram(
+    unsigned counts[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned bins,
+    const int32_t lower,
+    const right_shift_t bin_shr);
+
+
+/**
+ * @brief Get the element of a given rank in a 32-bit vector, partially reordering the vector.
+ * 
+ * `b[]` represents the 32-bit vector @vector{b}, which is reordered in-place. It must begin at a word-aligned 
+ * address.
+ * 
+ * `length` is the number of elements in @vector{b}. It must be non-zero.
+ * 
+ * `n` is the rank of the element to be found, which must be less than `length`. The element of rank 0 is the 
+ * minimum, and that of rank `length-1` is the maximum.
+ * 
+ * On return @vector{b} has been reordered such that @math{b_n} is the element that would be at index @math{n} if 
+ * @vector{b} were sorted in ascending order, no element before it is greater than it and no element after it is 
+ * less than it. @math{b_n} is also returned.
+ * 
+ * This uses quickselect, taking on average @math{O(length)} time rather than the @math{O(length \cdot log(length))}
+ * of a full sort.
+ * 
+ * @param[inout]    b           Vector @vector{b}
+ * @param[in]       length      Number of elements in @vector{b}
+ * @param[in]       n           Rank @math{n} of the element to find
+ * 
+ * @returns The element of rank @math{n}
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+int32_t xs3_vect_s32_nth_element(
+    int32_t b[],
+    const unsigned length,
+    const unsigned n);
+
+
+/**
+ * @brief Soft-clipping curves supported by xs3_vect_s32_softclip().
+ * 
+ * @see xs3_vect_s32_softclip(), bfp_s32_softclip()
+ * 
+ * @ingroup xs3_vect32_func
+ */
+typedef enum {
+  /**
+   * Cubic curve, reaching its limit at an input of @math{\pm 1}, with a continuous first derivative.
+   * 
+   * @math{ f(u) = \begin\{cases\}
+   *           \frac{3u - u^3}{2} & \left| u \right| \lt 1  \\
+   *           sgn(u) & otherwise 
+   *          \end\{cases\} }
+   */
+  SOFTCLIP_CUBIC = 0,
+
+  /**
+   * Hyperbolic tangent, evaluated by linear interpolation in a 257-entry table. The input saturates 
+   * at @math{\pm 2}, so the output magnitude is at most @math{tanh(2) \approx 0.964}.
+   * 
+   * @math{ f(u) = tanh(u) }
+   */
+  SOFTCLIP_TANH = 1,
+} softclip_curve_e;
+
+
+/**
+ * @brief Apply a soft-clipping (saturating waveshaper) curve to the elements of a 32-bit vector.
+ * 
+ * `a[]` and `b[]` represent the 32-bit vectors @vector{a} and @vector{b} respectively. Each must begin at a 
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b}, which are then taken as Q2.30
+ * values @math{u_k}. As with the VPU's `VLASHR` instruction, the shifted values saturate to 32 bits.
+ * 
+ * `curve` selects the curve @math{f(u)} applied to each element. See @ref softclip_curve_e. The output elements 
+ * are Q2.30 values in the range @math{[-1, 1]}. Products are rounded and saturated as with the VPU's `VLMUL` 
+ * instruction.
+ * 
+ * @operation{
+ * &     u_k \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor) \cdot 2^{-30}  \\
+ * &     a_k \leftarrow f(u_k) \cdot 2^{30}                                          \\
+ * &     \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then @math{b\_shr = -30 - b\_exp} 
+ * applies the curve to the values of @math{\bar{b}}, and the output vector @vector{a} are the mantissas of BFP 
+ * vector @math{\bar{a} \cdot 2^{-30}}.
+ * @endparblock
+ * 
+ * @param[out]  a               Output vector @vector{a}
+ * @param[in]   b               Input vector @vector{b}
+ * @param[in]   length          Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   b_shr           Arithmetic right-shift applied to elements of @vector{b}
+ * @param[in]   curve           Soft-clipping curve
+ * 
+ * @returns  Headroom of output vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_softclip(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const softclip_curve_e curve);
+
+
+/**
+ * @brief Compute the cumulative sum (inclusive prefix sum) of a 32-bit vector.
+ * 
+ * `a[]` and `b[]` represent the 32-bit mantissa vectors @vector{a} and @vector{b} respectively. Each must begin at a
+ * word-aligned address. This operation can be performed safely in-place on `b[]`.
+ * 
+ * `length` is the number of elements in each of the vectors.
+ * 
+ * `a_shr` is the signed arithmetic right-shift applied to each of the partial sums, with rounding. The results are
+ * then saturated to 32 bits.
+ * 
+ * The running sum is accumulated exactly in 64 bits, and only the outputs are shifted, so rounding errors do not 
+ * accumulate along the vector: each output element is within half an LSB of the exact partial sum.
+ * 
+ * @operation{
+ * &     s_k \leftarrow \sum_{i=0}^{k} b_i                                              \\
+ * &     a_k \leftarrow sat_{32}(round(s_k \cdot 2^{-a\_shr}))                          \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the output vector @vector{a}
+ * are the mantissas of BFP vector @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp + a\_shr}.
+ * 
+ * xs3_vect_s32_cumsum_prepare() can be used to obtain values for @math{a\_exp} and @math{a\_shr} which avoid
+ * saturation.
+ * @endparblock
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in vectors @vector{a} and @vector{b}
+ * @param[in]   a_shr       Right-shift applied to the partial sums
+ * 
+ * @returns  Headroom of output vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if `a` or `b` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_s32_cumsum_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_cumsum(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t a_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shift used by xs3_vect_s32_cumsum().
+ * 
+ * No partial sum of @vector{b} can exceed @math{length} times the largest magnitude in @vector{b}, so `a_shr` is 
+ * chosen as the smallest shift which guarantees that xs3_vect_s32_cumsum() will not saturate. The output vector 
+ * may then have up to @math{\lceil log_2(length) \rceil} bits of headroom, depending on the data.
+ * 
+ * @param[out]  a_exp       Exponent of output vector @vector{a}
+ * @param[out]  a_shr       Right-shift to be applied to the partial sums
+ * @param[in]   length      Number of elements in vector @vector{b}
+ * @param[in]   b_exp       Exponent of vector @vector{b}
+ * @param[in]   b_hr        Headroom of vector @vector{b}
+ * 
+ * @see xs3_vect_s32_cumsum
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_cumsum_prepare(
+    exponent_t* a_exp,
+    right_shift_t* a_shr,
+    const unsigned length,
+    const exponent_t b_exp,
+    const headroom_t b_hr);
+
+
+/**
+ * @brief Build a multi-resolution min/max/mean-square summary (pyramid) of a 32-bit vector.
+ * 
+ * This function computes, in a single pass over @vector{b}, the maximum, minimum and mean-square of each aligned 
+ * block of @math{2^l} elements of @vector{b}, for each level @math{l} from @math{1} to @math{L}. Level @math{1} 
+ * summarizes pairs of elements of @vector{b}, and each subsequent level summarizes pairs of elements of the level 
+ * below it. This is the structure needed for e.g. zoomable waveform displays.
+ * 
+ * `max[]`, `min[]` and `mean_sq[]` represent the 32-bit output vectors @vector{M}, @vector{m} and @vector{P}
+ * respectively. Each must begin at a word-aligned address, and each must have room for 
+ * @math{length - (length \gg L)} elements. All levels are laid out contiguously in each output vector, from finest
+ * to coarsest. Level @math{l} has @math{length \cdot 2^{-l}} elements and begins at offset 
+ * @math{length - length \cdot 2^{1-l}}.
+ * 
+ * `b[]` represents the 32-bit input vector @vector{b}. It must begin at a word-aligned address.
+ * 
+ * `length` is the number of elements in @vector{b}. It must be a multiple of @math{2^L}.
+ * 
+ * `levels` is the number of levels @math{L}. It must be at least @math{1}.
+ * 
+ * `sq_shr` is the signed arithmetic right-shift applied to the (64-bit) squares of elements of @vector{b} to
+ * produce the first level of @vector{P}. The first level of @vector{P} is rounded and saturated to 32 bits. Each 
+ * subsequent level is the rounded average of pairs from the level below, so an element of level @math{l} is within
+ * @math{l/2} of the exact mean-square.
+ * 
+ * @operation{
+ * &     M^{(1)}_k \leftarrow max(b_{2k}, b_{2k+1})                                        \\
+ * &     m^{(1)}_k \leftarrow min(b_{2k}, b_{2k+1})                                        \\
+ * &     P^{(1)}_k \leftarrow sat_{32}(round(\frac{b_{2k}^2 + b_{2k+1}^2}{2} \cdot 2^{-sq\_shr}))  \\
+ * &     M^{(l+1)}_k \leftarrow max(M^{(l)}_{2k}, M^{(l)}_{2k+1})                          \\
+ * &     m^{(l+1)}_k \leftarrow min(m^{(l)}_{2k}, m^{(l)}_{2k+1})                          \\
+ * &     P^{(l+1)}_k \leftarrow round(\frac{P^{(l)}_{2k} + P^{(l)}_{2k+1}}{2})            \\
+ * &         \qquad\text{ for }l\in 1\ ...\ (L-1)\text{ and }k\in 0\ ...\ (length \cdot 2^{-l-1} - 1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then @vector{M} and @vector{m} 
+ * are the mantissas of BFP vectors with exponent @math{b\_exp}, and @vector{P} are the mantissas of a BFP vector
+ * with exponent @math{2 \cdot b\_exp + sq\_shr}.
+ * 
+ * If @vector{b} has headroom @math{b\_hr}, then @math{sq\_shr = 32 - 2 \cdot b\_hr} is the smallest shift which
+ * avoids saturation of @vector{P}.
+ * @endparblock
+ * 
+ * @param[out]  max         Output vector of block maxima @vector{M}
+ * @param[out]  min         Output vector of block minima @vector{m}
+ * @param[out]  mean_sq     Output vector of block mean-squares @vector{P}
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * @param[in]   levels      Number of levels @math{L}
+ * @param[in]   sq_shr      Right-shift applied to the squares of elements of @vector{b}
+ * 
+ * @exception ET_LOAD_STORE Raised if `max`, `min`, `mean_sq` or `b` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+void xs3_vect_s32_pyramid(
+    int32_t max[],
+    int32_t min[],
+    int32_t mean_sq[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned levels,
+    const right_shift_t sq_shr);
+
+
+/**
+ * @brief Compute the energy and the number of zero crossings of a 32-bit vector in a single pass.
+ * 
+ * This function computes the same energy as xs3_vect_s32_energy(), and also counts the number of times the sign
+ * of @vector{b} changes between neighbouring elements. Zero is treated as non-negative (as with 
+ * xs3_vect_s8_is_negative()), so a crossing is counted whenever the sign bits of @math{b_{k-1}} and @math{b_k} 
+ * differ. These are the time-domain features typically used for voice activity detection. Dividing the number of
+ * zero crossings by @math{length-1} gives the zero-crossing rate.
+ * 
+ * `b[]` represents the 32-bit mantissa vector @vector{b}. `b[]` must begin at a word-aligned address.
+ * 
+ * `zero_crossings` points to the output zero-crossing count @math{z}.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * `b_shr` is the signed arithmetic right-shift applied to elements of @vector{b} when computing the energy. It has no
+ * effect on the zero-crossing count.
+ * 
+ * @operation{
+ * &     b_k' \leftarrow sat_{32}(\lfloor b_k \cdot 2^{-b\_shr} \rfloor)                 \\
+ * &     e \leftarrow \sum_{k=0}^{length-1} round((b_k')^2 \cdot 2^{-30})               \\
+ * &     z \leftarrow \sum_{k=1}^{length-1} \left[ (b_k < 0) \ne (b_{k-1} < 0) \right]
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{b} are the mantissas of the BFP vector @math{\bar{b} \cdot 2^{b\_exp}}, then the energy is 
+ * @math{e \cdot 2^{e\_exp}}, where @math{e\_exp = 30 + 2 \cdot (b\_exp + b\_shr)}.
+ * 
+ * The function xs3_vect_s32_energy_prepare() can be used to obtain values for @math{e\_exp} and @math{b\_shr}. The 
+ * same restrictions on `length` described for xs3_vect_s32_energy() apply.
+ * @endparblock
+ * 
+ * @param[out]  zero_crossings  Output zero-crossing count @math{z}
+ * @param[in]   b               Input vector @vector{b}
+ * @param[in]   length          Number of elements in @vector{b}
+ * @param[in]   b_shr           Right-shift appled to @vector{b} for the energy computation
+ * 
+ * @returns     Energy mantissa @math{e}
+ * 
+ * @see xs3_vect_s32_energy_prepare,
+ *      xs3_vect_s32_energy
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+int64_t xs3_vect_s32_energy_zcr(
+    unsigned* zero_crossings,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr);
+
+
+/**
+ * @brief Compute the spectral flatness of a 32-bit power spectrum.
+ * 
+ * The spectral flatness (Wiener entropy) is the ratio of the geometric mean to the arithmetic mean of the power
+ * spectrum. It is close to @math{1} for noise-like frames and close to @math{0} for tonal (e.g. voiced) frames, 
+ * which makes it a useful feature for voice activity detection.
+ * 
+ * `b[]` represents the 32-bit mantissa vector @vector{b}, which holds the (non-negative) power of each frequency bin.
+ * `b[]` must begin at a word-aligned address. Because the ratio does not depend on the exponent of @vector{b}, only
+ * the mantissas are needed.
+ * 
+ * `length` is the number of elements in @vector{b}.
+ * 
+ * Both means are computed in a single pass, in the log domain. The logarithm of each element is found by 
+ * normalization followed by table interpolation, so the result is accurate to within about @math{2^{-13}}. If any 
+ * element of @vector{b} is zero (or negative), the geometric mean, and so the result, is zero.
+ * 
+ * @operation{
+ * &     a \leftarrow \frac{\left( \prod_{k=0}^{length-1} b_k \right)^{1/length}}
+ *                         {\frac{1}{length}\sum_{k=0}^{length-1} b_k} \cdot 2^{30}
+ * }
+ * 
+ * @param[in]   b           Input vector @vector{b}
+ * @param[in]   length      Number of elements in @vector{b}
+ * 
+ * @returns     Spectral flatness @math{a}, as a Q2.30 value in the range @math{[0, 1]}
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+fixed_s32_t xs3_vect_s32_spectral_flatness(
+    const int32_t b[],
+    const unsigned length);
+
+
+/**
+ * @brief Compute a weighted sum of several delayed 32-bit vectors in a single pass.
+ * 
+ * This is the core of a time-domain delay-and-sum beamformer. Each output element is a weighted sum over 
+ * `channels` input vectors, with all of the products for an output element accumulated together before a single
+ * rounding shift is applied to the result.
+ * 
+ * `a[]` represents the 32-bit output vector @vector{a}. `a` must begin at a word-aligned address.
+ * 
+ * `b[]` is an array of `channels` pointers, where `b[i]` points to the first element of 32-bit input vector 
+ * @vector{b_i}. Any delay to be applied to a channel is expressed by offsetting its pointer, so these need not be 
+ * word-aligned.
+ * 
+ * `gain_q30[]` holds the `channels` weights @math{g_i}, as Q2.30 values.
+ * 
+ * `b_shr[]` holds the signed arithmetic right-shift applied to each input vector before it is multiplied by its 
+ * weight, and `a_shr` is the unsigned arithmetic right-shift applied to the accumulated sum. Products are accumulated
+ * with 40-bit saturation, so `channels` must not exceed @math{128}.
+ * 
+ * `length` is the number of elements in @vector{a} and in each @vector{b_i}.
+ * 
+ * @operation{
+ * &     b_{i,k}' \leftarrow sat_{32}(\lfloor b_{i,k} \cdot 2^{-b\_shr_i} \rfloor)                           \\
+ * &     a_k \leftarrow sat_{32}\!\left( round\!\left( 
+ *                 \sum_{i=0}^{channels-1} round(b_{i,k}' \cdot g_i \cdot 2^{-30}) \cdot 2^{-a\_shr} 
+ *             \right) \right)                                                                                  \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If each @vector{b_i} are the mantissas of a BFP vector @math{\bar{b_i} \cdot 2^{b\_exp_i}} and 
+ * @math{b\_exp_i + b\_shr_i} is the same for every channel, then @vector{a} are the mantissas of the BFP vector
+ * @math{\bar{a} \cdot 2^{a\_exp}}, where @math{a\_exp = b\_exp_i + b\_shr_i + a\_shr}.
+ * 
+ * xs3_vect_s32_weighted_sum_prepare() can be used to obtain values for @math{a\_exp}, @math{b\_shr_i} and 
+ * @math{a\_shr}.
+ * @endparblock
+ * 
+ * @param[out]  a           Output vector @vector{a}
+ * @param[in]   b           Input vectors @vector{b_i}
+ * @param[in]   gain_q30    Channel weights @math{g_i}
+ * @param[in]   b_shr       Right-shift applied to each input vector
+ * @param[in]   channels    Number of input vectors
+ * @param[in]   length      Number of elements in @vector{a} and each @vector{b_i}
+ * @param[in]   a_shr       Right-shift applied to the accumulated sum
+ * 
+ * @returns  Headroom of output vector @vector{a}
+ * 
+ * @exception ET_LOAD_STORE Raised if `a` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_s32_weighted_sum_prepare
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_weighted_sum(
+    int32_t a[],
+    const int32_t* const b[],
+    const fixed_s32_t gain_q30[],
+    const right_shift_t b_shr[],
+    const unsigned channels,
+    const unsigned length,
+    const right_shift_t a_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shifts used by xs3_vect_s32_weighted_sum().
+ * 
+ * The input shifts `b_shr[]` align every channel to a common exponent, which is chosen so that the channel with the
+ * largest magnitude bound (given its exponent and headroom) has no headroom after shifting. Channels with a zero 
+ * weight are ignored. `a_shr` is then the smallest shift for which the sum of the channels' weighted magnitude bounds
+ * cannot saturate, so no pass over the data is needed to choose the output exponent.
+ * 
+ * @param[out]  a_exp       Exponent of output vector @vector{a}
+ * @param[out]  b_shr       Right-shift to be applied to each input vector
+ * @param[out]  a_shr       Right-shift to be applied to the accumulated sum
+ * @param[in]   b_exp       Exponent of each input vector
+ * @param[in]   b_hr        Headroom of each input vector
+ * @param[in]   gain_q30    Channel weights @math{g_i}
+ * @param[in]   channels    Number of input vectors
+ * 
+ * @see xs3_vect_s32_weighted_sum
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_weighted_sum_prepare(
+    exponent_t* a_exp,
+    right_shift_t b_shr[],
+    right_shift_t* a_shr,
+    const exponent_t b_exp[],
+    const headroom_t b_hr[],
+    const fixed_s32_t gain_q30[],
+    const unsigned channels);
+
+
+/**
+ * @brief Update a bank of one-pole smoothers with a shared coefficient.
+ * 
+ * Each element of @vector{y} is the state of a first-order lowpass (one-pole) smoother, which is moved towards the
+ * corresponding element of @vector{x} by a fraction @math{c} of the difference between them. This is the usual way of
+ * smoothing per-bin parameters such as gains or steering weights from frame to frame.
+ * 
+ * `y[]` represents the 32-bit smoother state vector @vector{y}, which is updated in-place. `x[]` represents the 32-bit
+ * input vector @vector{x}. Each must begin at a word-aligned address.
+ * 
+ * `coef_q30` is the smoothing coefficient @math{c}, a Q2.30 value in the range @math{[0, 1]}. A coefficient of 
+ * @math{1} copies @vector{x} into @vector{y}, and a coefficient of @math{0} leaves @vector{y} unchanged (apart from 
+ * the shift).
+ * 
+ * `y_shr` and `x_shr` are the signed arithmetic right-shifts applied to elements of @vector{y} and @vector{x} before
+ * they are combined. Because the update is a convex combination of the two shifted inputs, it cannot saturate unless
+ * one of the shifts does.
+ * 
+ * @operation{
+ * &     y_k' \leftarrow sat_{32}(\lfloor y_k \cdot 2^{-y\_shr} \rfloor)                 \\
+ * &     x_k' \leftarrow sat_{32}(\lfloor x_k \cdot 2^{-x\_shr} \rfloor)                 \\
+ * &     y_k \leftarrow y_k' + c \cdot (x_k' - y_k')                                    \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @par Block Floating-Point
+ * @parblock
+ * 
+ * If @vector{y} and @vector{x} are the mantissas of BFP vectors @math{\bar{y} \cdot 2^{y\_exp}} and 
+ * @math{\bar{x} \cdot 2^{x\_exp}}, and @math{y\_exp + y\_shr = x\_exp + x\_shr}, then the updated @vector{y} are the
+ * mantissas of a BFP vector with exponent @math{y\_exp + y\_shr}.
+ * 
+ * xs3_vect_s32_smooth_prepare() can be used to obtain values for the new exponent, @math{y\_shr} and 
+ * @math{x\_shr}.
+ * @endparblock
+ * 
+ * @param[inout]    y           Smoother state vector @vector{y}
+ * @param[in]       x           Input vector @vector{x}
+ * @param[in]       coef_q30    Smoothing coefficient @math{c}
+ * @param[in]       length      Number of elements in vectors @vector{y} and @vector{x}
+ * @param[in]       y_shr       Right-shift applied to @vector{y}
+ * @param[in]       x_shr       Right-shift applied to @vector{x}
+ * 
+ * @returns  Headroom of the updated vector @vector{y}
+ * 
+ * @exception ET_LOAD_STORE Raised if `y` or `x` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_s32_smooth_prepare,
+ *      xs3_vect_s32_smooth_vect
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_smooth(
+    int32_t y[],
+    const int32_t x[],
+    const fixed_s32_t coef_q30,
+    const unsigned length,
+    const right_shift_t y_shr,
+    const right_shift_t x_shr);
+
+
+/**
+ * @brief Update a bank of one-pole smoothers with per-element coefficients.
+ * 
+ * This function is the same as xs3_vect_s32_smooth(), except that each smoother has its own coefficient 
+ * @math{c_k}, taken from `coef_q30[]`.
+ * 
+ * @operation{
+ * &     y_k' \leftarrow sat_{32}(\lfloor y_k \cdot 2^{-y\_shr} \rfloor)                 \\
+ * &     x_k' \leftarrow sat_{32}(\lfloor x_k \cdot 2^{-x\_shr} \rfloor)                 \\
+ * &     y_k \leftarrow y_k' + c_k \cdot (x_k' - y_k')                                  \\
+ * &         \qquad\text{ for }k\in 0\ ...\ (length-1)
+ * }
+ * 
+ * @param[inout]    y           Smoother state vector @vector{y}
+ * @param[in]       x           Input vector @vector{x}
+ * @param[in]       coef_q30    Smoothing coefficients @math{c_k}, Q2.30 values in the range @math{[0, 1]}
+ * @param[in]       length      Number of elements in vectors @vector{y}, @vector{x} and `coef_q30`
+ * @param[in]       y_shr       Right-shift applied to @vector{y}
+ * @param[in]       x_shr       Right-shift applied to @vector{x}
+ * 
+ * @returns  Headroom of the updated vector @vector{y}
+ * 
+ * @exception ET_LOAD_STORE Raised if `y`, `x` or `coef_q30` is not word-aligned (See @ref note_vector_alignment)
+ * 
+ * @see xs3_vect_s32_smooth_prepare,
+ *      xs3_vect_s32_smooth
+ * 
+ * @ingroup xs3_vect32_func
+ */
+C_API
+headroom_t xs3_vect_s32_smooth_vect(
+    int32_t y[],
+    const int32_t x[],
+    const fixed_s32_t coef_q30[],
+    const unsigned length,
+    const right_shift_t y_shr,
+    const right_shift_t x_shr);
+
+
+/**
+ * @brief Obtain the output exponent and shifts used by xs3_vect_s32_smooth() and xs3_vect_s32_smooth_vect().
+ * 
+ * Both operands are aligned to the exponent at which the larger of them (given its exponent and headroom) has no 
+ * headroom. The smoother update cannot increase magnitudes, so no further shift is needed.
+ * 
+ * @param[out]  new_y_exp   Exponent of the updated vector @vector{y}
+ * @param[out]  y_shr       Right-shift to be applied to @vector{y}
+ * @param[out]  x_shr       Right-shift to be applied to @vector{x}
+ * @param[in]   y_exp       Exponent of vector @vector{y}
+ * @param[in]   x_exp       Exponent of vector @vector{x}
+ * @param[in]   y_hr        Headroom of vector @vector{y}
+ * @param[in]   x_hr        Headroom of vector @vector{x}
+ * 
+ * @see xs3_vect_s32_smooth,
+ *      xs3_vect_s32_smooth_vect
+ * 
+ * @ingroup xs3_vect32_prepare
+ */
+C_API
+void xs3_vect_s32_smooth_prepare(
+    exponent_t* new_y_exp,
+    right_shift_t* y_shr,
+    right_shift_t* x_shr,
+    const exponent_t y_exp,
+    const exponent_t x_exp,
+    const headroom_t y_hr,
+    const headroom_t x_hr);
+
+
 #ifdef __XC__
 }   //extern "C"
 #endif
@@ -117,6 +117,34 @@
 
 
 
+/**
+ * @page conf_option_delay_and_sum_channels Delay-and-Sum Maximum Channels
+ * 
+ * @par Delay-and-Sum Maximum Channels
+ * 
+ * @ref XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS
+ * 
+ * The function bfp_s32_delay_and_sum() keeps a small amount of per-channel information on the stack. This is the 
+ * largest number of input channels it accepts.
+ * 
+ * Defaults to 32
+ * 
+ * @see bfp_s32_delay_and_sum
+ */
+#ifndef XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS
+
+/**
+ * The maximum number of input channels accepted by bfp_s32_delay_and_sum().
+ * 
+ * See @ref conf_option_delay_and_sum_channels for details.
+ * 
+ * @ingroup conf_option_macro
+ */
+#define XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS (32)
+#endif
+
+
+
 /**
  * @page conf_option_malloc_func Dynamic Allocation Function
  * 
@@ -384,6 +384,44 @@ typedef struct {
 } bfp_complex_s16_t;
 //! [bfp_complex_s16_t]
 
+/**
+ * @brief A block floating-point vector of complex 32-bit elements, with planar (split) storage.
+ * 
+ * Initialized with the ``bfp_complex_s32_planar_init()`` function.
+ * 
+ * Like ``bfp_complex_s16_t`` (and unlike ``bfp_complex_s32_t``), the real and imaginary parts of
+ * the mantissas are stored in separate buffers. Element-wise complex arithmetic then only needs
+ * contiguous real loads and stores. Use ``bfp_complex_s32_to_planar()`` and
+ * ``bfp_complex_s32_from_planar()`` to convert to and from the interleaved layout used by the FFT.
+ * 
+ * The logical quantity represented by each element of this vector is:
+ *      ``real[k] * 2^(exp) + i * imag[k] * 2^(exp)``
+ *      where the multiplication and exponentiation are using real (non-modular) arithmetic, and
+ *      i is sqrt(-1)
+ * 
+ * The BFP API keeps the ``hr`` field up-to-date with the current headroom of ``real[]`` and
+ * ``imag[]`` so as to minimize precision loss as elements become small.
+ * 
+ * @ingroup type_bfp
+ */
+//! [bfp_complex_s32_planar_t]
+C_TYPE
+typedef struct {
+    /** Pointer to the buffer holding the real parts of the mantissas.*/
+    int32_t* real;
+    /** Pointer to the buffer holding the imaginary parts of the mantissas.*/
+    int32_t* imag;
+    /** Exponent associated with the vector. */
+    exponent_t exp;
+    /** Current headroom in ``real[]`` and ``imag[]`` */
+    headroom_t hr;
+    /** Current size of ``real[]`` and ``imag[]``, expressed in elements */
+    unsigned length;
+    /** BFP vector flags. Users should not normally modify these manually. */
+    bfp_flags_e flags;
+} bfp_complex_s32_planar_t;
+//! [bfp_complex_s32_planar_t]
+
 
 // Some standard float types required by some of the unit tests. @todo This probably belongs elsewhere
 
@@ -429,4 +467,40 @@ C_TYPE
 typedef struct {
   int16_t vD[16];   ///< Most significant 16 bits of accumulators
   uint16_t vR[16];  ///< Least significant 16 bits of accumulators
-} xs3_split_acc_s32_t;
\ No newline at end of file
+} xs3_split_acc_s32_t;
+
+/**
+ * @brief Summary statistics of a 32-bit mantissa vector, as computed by xs3_vect_s32_stats().
+ * 
+ * `max`, `min`, `argmax` and `argmin` are as returned by xs3_vect_s32_max(), xs3_vect_s32_min(),
+ * xs3_vect_s32_argmax() and xs3_vect_s32_argmin() respectively. `sum` is as returned by 
+ * xs3_vect_s32_sum(), and `energy` is as returned by xs3_vect_s32_energy().
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    int32_t max;        ///< Maximum element
+    int32_t min;        ///< Minimum element
+    unsigned argmax;    ///< Index of the (first) maximum element
+    unsigned argmin;    ///< Index of the (first) minimum element
+    int64_t sum;        ///< Sum of elements
+    int64_t energy;     ///< Sum of squares of (shifted) elements
+} xs3_vect_s32_stats_t;
+
+
+/**
+ * @brief Summary statistics of a 32-bit BFP vector, as computed by bfp_s32_stats().
+ * 
+ * @ingroup type_misc
+ */
+C_TYPE
+typedef struct {
+    float_s32_t max;    ///< Maximum element
+    float_s32_t min;    ///< Minimum element
+    unsigned argmax;    ///< Index of the (first) maximum element
+    unsigned argmin;    ///< Index of the (first) minimum element
+    float_s64_t sum;    ///< Sum of elements
+    float_s32_t mean;   ///< Mean of elements
+    float_s64_t energy; ///< Sum of squares of elements
+} bfp_s32_stats_t;
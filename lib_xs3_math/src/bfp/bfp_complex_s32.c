@@ -7,6 +7,7 @@
 #include "vect/xs3_vect_s32.h"
 #include "vect/xs3_vect_s16.h"
 #include "../vect/vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
 
 
 const extern unsigned rot_table32_rows;
@@ -142,6 +143,29 @@ void bfp_complex_s32_real_mul(
 }
 
 
+void bfp_complex_s32_apply_gain(
+    bfp_complex_s32_t* a, 
+    const bfp_complex_s32_t* b, 
+    const bfp_s32_t* gain)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length == gain->length);
+    assert(b->length != 0);
+#endif
+
+    // The shifts use the headroom of both operands, so that small gains (which have a lot of
+    // headroom) don't cost the output any precision.
+    exponent_t a_exp;
+    right_shift_t b_shr, gain_shr;
+
+    xs3_vect_complex_s32_real_mul_prepare(&a_exp, &b_shr, &gain_shr, b->exp, gain->exp, b->hr, gain->hr);
+
+    a->exp = a_exp;
+    a->hr = xs3_vect_complex_s32_real_mul(a->data, b->data, gain->data, b->length, b_shr, gain_shr);
+}
+
+
 void bfp_complex_s32_mul(
     bfp_complex_s32_t* a, 
     const bfp_complex_s32_t* b, 
@@ -378,6 +402,300 @@ void bfp_complex_s32_conj_nmacc(
 }
 
 
+void bfp_complex_s32_conj_macc_ema(
+    bfp_complex_s32_t* acc, 
+    const bfp_complex_s32_t* b, 
+    const bfp_complex_s32_t* c,
+    const fixed_s32_t alpha_q30)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == acc->length);
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    assert(alpha_q30 >= 0 && alpha_q30 <= 0x40000000);
+
+    exponent_t a_exp;
+    right_shift_t acc_shr, b_shr, c_shr;
+
+    xs3_vect_complex_s32_conj_macc_ema_prepare(&a_exp, &acc_shr, &b_shr, &c_shr, acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->exp = a_exp;
+    acc->hr = xs3_vect_complex_s32_conj_macc_ema(acc->data, b->data, c->data, b->length, 
+                                                 alpha_q30, acc_shr, b_shr, c_shr);
+}
+
+
+void bfp_complex_s32_conj_macc_ema_pairs(
+    bfp_complex_s32_t acc[], 
+    const bfp_complex_s32_t x[],
+    const unsigned channels,
+    const fixed_s32_t alpha_q30)
+{
+    // Only the upper triangle (including the diagonal) is kept, in row-major order. The lower
+    // triangle is its conjugate, so updating it as well would just double the work.
+    unsigned p = 0;
+
+    for(int i = 0; i < channels; i++){
+        for(int j = i; j < channels; j++){
+            bfp_complex_s32_conj_macc_ema(&acc[p++], &x[i], &x[j], alpha_q30);
+        }
+    }
+}
+
+
+// Marks a bin whose solution is forced to zero in bfp_complex_s32_hermitian_solve()
+#define HERM_DEAD_BIN   INT32_MIN
+
+// Smallest normalized pivot (as a power of 2) treated as non-singular
+#define HERM_MIN_PIVOT_EXP  (-24)
+
+
+/*
+ * Index of element (i,j), i <= j, of an order-`order` Hermitian matrix whose upper triangle is 
+ * stored in row-major order.
+ */
+static inline unsigned herm_index(
+    const unsigned i,
+    const unsigned j,
+    const unsigned order)
+{
+    return i * order - ((i * (i - 1)) >> 1) + (j - i);
+}
+
+
+/*
+ * While the factorization is in progress, the diagonal element R_jj holds the real pivot vector
+ * D_j in the first half of its buffer, with its exponent and headroom in R_jj's own fields.
+ */
+static inline void herm_diag_view(
+    bfp_s32_t* d,
+    const bfp_complex_s32_t* r)
+{
+    d->data = (int32_t*) r->data;
+    d->exp = r->exp;
+    d->hr = r->hr;
+    d->length = r->length;
+    d->flags = 0;
+}
+
+
+/*
+ * Scale each bin of R[] and b[] independently so that the largest diagonal element of the bin's
+ * matrix, and the largest element of the bin's right-hand side, are just below 1. All of R[] and
+ * x[] then have exponent -30. bin_exp[f] receives the exponent that the bin's solution must be
+ * scaled by afterwards, or HERM_DEAD_BIN if it is zero.
+ */
+static void herm_normalize(
+    bfp_complex_s32_t x[],
+    bfp_complex_s32_t R[],
+    const bfp_complex_s32_t b[],
+    const unsigned order,
+    int32_t bin_exp[])
+{
+    const unsigned length = b[0].length;
+
+    for(int f = 0; f < length; f++){
+        int top = INT32_MIN;
+        int rhs = INT32_MIN;
+
+        for(int i = 0; i < order; i++){
+            const bfp_complex_s32_t* r = &R[herm_index(i, i, order)];
+            const int32_t d = r->data[f].re;
+            if(d > 0)
+                top = MAX(top, r->exp + 31 - (int) HR_S32(d));
+
+            const complex_s32_t v = b[i].data[f];
+            if(v.re != 0 || v.im != 0)
+                rhs = MAX(rhs, b[i].exp + 31 - (int) MIN(HR_S32(v.re), HR_S32(v.im)));
+        }
+
+        // top and rhs are INT32_MIN for a dead bin, so no shifts may be computed from them
+        const unsigned dead = (top == INT32_MIN) || (rhs == INT32_MIN);
+        bin_exp[f] = dead? HERM_DEAD_BIN : rhs - top;
+
+        for(int i = 0; i < order; i++){
+            for(int j = i; j < order; j++){
+                bfp_complex_s32_t* r = &R[herm_index(i, j, order)];
+                const right_shift_t shr = dead? 0 : top - 30 - r->exp;
+
+                if(i == j){
+                    // The diagonal is real, so it's packed into the pivot layout (see herm_diag_view())
+                    ((int32_t*) r->data)[f] = dead? 0 : vlashr32(r->data[f].re, shr);
+                } else {
+                    r->data[f].re = dead? 0 : vlashr32(r->data[f].re, shr);
+                    r->data[f].im = dead? 0 : vlashr32(r->data[f].im, shr);
+                }
+            }
+
+            const right_shift_t shr = dead? 0 : rhs - 30 - b[i].exp;
+            const complex_s32_t v = b[i].data[f];
+            x[i].data[f].re = dead? 0 : vlashr32(v.re, shr);
+            x[i].data[f].im = dead? 0 : vlashr32(v.im, shr);
+        }
+    }
+
+    for(int i = 0; i < order; i++){
+        for(int j = i; j < order; j++){
+            bfp_complex_s32_t* r = &R[herm_index(i, j, order)];
+            r->exp = -30;
+
+            if(i == j) r->hr = xs3_vect_s32_headroom((int32_t*) r->data, length);
+            else       bfp_complex_s32_headroom(r);
+        }
+
+        x[i].exp = -30;
+        bfp_complex_s32_headroom(&x[i]);
+    }
+}
+
+
+/*
+ * Retire any bin whose pivot is too small (i.e. whose matrix is singular or not positive definite
+ * to within working precision). The pivots of retired bins are replaced with the largest live
+ * pivot, so that they affect neither the inverse's exponent nor any live bin.
+ */
+static void herm_check_pivot(
+    bfp_s32_t* d,
+    int32_t bin_exp[])
+{
+    int32_t safe = 0;
+
+    for(int f = 0; f < d->length; f++){
+        const int32_t v = d->data[f];
+        const unsigned small = (v <= 0) || (d->exp + 31 - (int) HR_S32(v) <= HERM_MIN_PIVOT_EXP);
+
+        if(small) bin_exp[f] = HERM_DEAD_BIN;
+        if(bin_exp[f] != HERM_DEAD_BIN) safe = MAX(safe, v);
+    }
+
+    if(safe == 0) safe = 0x40000000;
+
+    for(int f = 0; f < d->length; f++)
+        if(bin_exp[f] == HERM_DEAD_BIN) d->data[f] = safe;
+
+    bfp_s32_headroom(d);
+}
+
+
+/*
+ * Undo the per-bin scaling applied by herm_normalize(). Each output vector takes the exponent of
+ * its largest bin.
+ */
+static void herm_denormalize(
+    bfp_complex_s32_t* x,
+    const int32_t bin_exp[])
+{
+    int max_exp = INT32_MIN;
+
+    for(int f = 0; f < x->length; f++)
+        if(bin_exp[f] != HERM_DEAD_BIN) max_exp = MAX(max_exp, bin_exp[f]);
+
+    for(int f = 0; f < x->length; f++){
+        const unsigned dead = (bin_exp[f] == HERM_DEAD_BIN);
+        const right_shift_t shr = dead? 0 : max_exp - bin_exp[f];
+        x->data[f].re = dead? 0 : vlashr32(x->data[f].re, shr);
+        x->data[f].im = dead? 0 : vlashr32(x->data[f].im, shr);
+    }
+
+    if(max_exp != INT32_MIN) x->exp += max_exp;
+    bfp_complex_s32_headroom(x);
+}
+
+
+void bfp_complex_s32_hermitian_solve(
+    bfp_complex_s32_t x[],
+    bfp_complex_s32_t R[],
+    const bfp_complex_s32_t b[],
+    const unsigned order,
+    int32_t scratch[])
+{
+    const unsigned length = b[0].length;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(order != 0);
+    assert(length != 0);
+    for(int i = 0; i < order; i++){
+        assert(x[i].length == length);
+        assert(b[i].length == length);
+    }
+    for(int p = 0; p < (order * (order + 1)) / 2; p++)
+        assert(R[p].length == length);
+#endif
+
+    bfp_complex_s32_t tmp;
+    bfp_s32_t tmp_r, D_j, D_k;
+
+    bfp_complex_s32_init(&tmp, (complex_s32_t*) &scratch[0], 0, length, 0);
+    bfp_s32_init(&tmp_r, &scratch[2 * length], 0, length, 0);
+    int32_t* bin_exp = &scratch[3 * length];
+
+    herm_normalize(x, R, b, order, bin_exp);
+
+    // Factorize R = U^H D U in place, where U is unit upper triangular and D is real diagonal.
+    // Each step is an element-wise operation over all bins at once.
+    for(int j = 0; j < order; j++){
+        bfp_complex_s32_t* R_jj = &R[herm_index(j, j, order)];
+        herm_diag_view(&D_j, R_jj);
+
+        // D_j = R_jj - sum_{k<j} D_k |U_kj|^2
+        for(int k = 0; k < j; k++){
+            herm_diag_view(&D_k, &R[herm_index(k, k, order)]);
+            bfp_complex_s32_squared_mag(&tmp_r, &R[herm_index(k, j, order)]);
+            bfp_s32_mul(&tmp_r, &tmp_r, &D_k);
+            bfp_s32_sub(&D_j, &D_j, &tmp_r);
+        }
+
+        herm_check_pivot(&D_j, bin_exp);
+        R_jj->exp = D_j.exp;
+        R_jj->hr = D_j.hr;
+
+        bfp_s32_inverse(&tmp_r, &D_j);
+
+        // U_ji = ( R_ji - sum_{k<j} D_k U_ki U_kj^* ) / D_j
+        for(int i = j + 1; i < order; i++){
+            bfp_complex_s32_t* R_ji = &R[herm_index(j, i, order)];
+
+            for(int k = 0; k < j; k++){
+                herm_diag_view(&D_k, &R[herm_index(k, k, order)]);
+                bfp_complex_s32_conj_mul(&tmp, &R[herm_index(k, i, order)], &R[herm_index(k, j, order)]);
+                bfp_complex_s32_real_mul(&tmp, &tmp, &D_k);
+                bfp_complex_s32_sub(R_ji, R_ji, &tmp);
+            }
+
+            bfp_complex_s32_real_mul(R_ji, R_ji, &tmp_r);
+        }
+    }
+
+    // Solve U^H y = b
+    for(int i = 0; i < order; i++){
+        for(int k = 0; k < i; k++){
+            bfp_complex_s32_conj_mul(&tmp, &x[k], &R[herm_index(k, i, order)]);
+            bfp_complex_s32_sub(&x[i], &x[i], &tmp);
+        }
+    }
+
+    // z = y / D
+    for(int i = 0; i < order; i++){
+        herm_diag_view(&D_j, &R[herm_index(i, i, order)]);
+        bfp_s32_inverse(&tmp_r, &D_j);
+        bfp_complex_s32_real_mul(&x[i], &x[i], &tmp_r);
+    }
+
+    // Solve U x = z
+    for(int i = order - 1; i >= 0; i--){
+        for(int k = i + 1; k < order; k++){
+            bfp_complex_s32_mul(&tmp, &R[herm_index(i, k, order)], &x[k]);
+            bfp_complex_s32_sub(&x[i], &x[i], &tmp);
+        }
+    }
+
+    for(int i = 0; i < order; i++)
+        herm_denormalize(&x[i], bin_exp);
+}
+
+
 void bfp_complex_s32_conjugate(
     bfp_complex_s32_t* a, 
     const bfp_complex_s32_t* b)
@@ -0,0 +1,140 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+
+
+const extern unsigned rot_table32_rows;
+const extern complex_s32_t rot_table32[30][4];
+
+
+headroom_t bfp_complex_s32_planar_headroom(
+    bfp_complex_s32_planar_t* a)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(a->length != 0);
+#endif
+
+    a->hr = xs3_vect_complex_s32_planar_headroom(a->real, a->imag, a->length);
+    return a->hr;
+}
+
+
+void bfp_complex_s32_to_planar(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    xs3_vect_s32_unzip(a->real, a->imag, b->data, b->length);
+
+    a->exp = b->exp;
+    a->hr = b->hr;
+}
+
+
+void bfp_complex_s32_from_planar(
+    bfp_complex_s32_t* a, 
+    const bfp_complex_s32_planar_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    xs3_vect_s32_zip(a->data, b->real, b->imag, b->length, 0, 0);
+
+    a->exp = b->exp;
+    a->hr = b->hr;
+}
+
+
+void bfp_complex_s32_planar_mul(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    exponent_t a_exp;
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_complex_s32_mul_prepare(&a_exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->exp = a_exp;
+    a->hr = xs3_vect_complex_s32_planar_mul(a->real, a->imag, b->real, b->imag, c->real, c->imag,
+                                            b->length, b_shr, c_shr);
+}
+
+
+void bfp_complex_s32_planar_conj_mul(
+    bfp_complex_s32_planar_t* a, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    exponent_t a_exp;
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_complex_s32_conj_mul_prepare(&a_exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->exp = a_exp;
+    a->hr = xs3_vect_complex_s32_planar_conj_mul(a->real, a->imag, b->real, b->imag, c->real, c->imag,
+                                                 b->length, b_shr, c_shr);
+}
+
+
+void bfp_complex_s32_planar_macc(
+    bfp_complex_s32_planar_t* acc, 
+    const bfp_complex_s32_planar_t* b, 
+    const bfp_complex_s32_planar_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == acc->length);
+    assert(b->length == c->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t acc_shr, b_shr, c_shr;
+    exponent_t a_exp;
+
+    xs3_vect_complex_s32_macc_prepare(&a_exp, &acc_shr, &b_shr, &c_shr, 
+                                      acc->exp, b->exp, c->exp, acc->hr, b->hr, c->hr);
+
+    acc->exp = a_exp;
+    acc->hr = xs3_vect_complex_s32_planar_macc(acc->real, acc->imag, b->real, b->imag, c->real, c->imag,
+                                               b->length, acc_shr, b_shr, c_shr);
+}
+
+
+void bfp_complex_s32_planar_mag(
+    bfp_s32_t* a, 
+    const bfp_complex_s32_planar_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr;
+
+    xs3_vect_complex_s32_mag_prepare(&a->exp, &b_shr, b->exp, b->hr);
+
+    a->hr = xs3_vect_complex_s32_planar_mag(a->data, b->real, b->imag, b->length, 
+                                            b_shr, (complex_s32_t*) rot_table32, rot_table32_rows);
+}
@@ -174,6 +174,14 @@ void bfp_fft_forward_stereo(
 
     const unsigned FFT_N = a->length;
 
+    // If b's data immediately follows a's, the two channels' buffers together are exactly large
+    // enough to hold the complex FFT input, and the whole transform can be done in-place.
+    complex_s32_t* x = (b->data == &a->data[FFT_N])? (complex_s32_t*) a->data : scratch;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x != NULL);
+#endif
+
     //The FFT implementation requires 2 bits of headroom to ensure no saturation occurs
     right_shift_t a_shr = 2 - a->hr;
     right_shift_t b_shr = 2 - b->hr;
@@ -185,12 +193,9 @@ void bfp_fft_forward_stereo(
     b->exp += b_shr;
 
     // The stereo FFT requires the input samples from a and b to be interleaved into a single 
-    // buffer. We'll zip them into scratch and apply the shifts.
-    xs3_vect_s32_zip(scratch, a->data, b->data, FFT_N, a_shr, b_shr);
-
-    // Boggle the elements of the input spectrum as required (bit-reversed indexing) by 
-    // xs3_fft_dit_forward(). (See comment above in bfp_fft_forward_mono())
-    xs3_fft_index_bit_reversal(scratch, FFT_N);
+    // buffer, with the elements in the bit-reversed order required by xs3_fft_dit_forward(). (See
+    // comment above in bfp_fft_forward_mono()) This is done in one pass, applying the shifts.
+    xs3_fft_zip_bit_reversal(x, a->data, b->data, FFT_N, a_shr, b_shr);
 
     // The change in each signal's exponent from FFTing
     exponent_t exp_diff = 0;
@@ -199,7 +204,7 @@ void bfp_fft_forward_stereo(
     headroom_t hr = a->hr;
 
     // Do the actual FFT
-    xs3_fft_dit_forward(scratch, FFT_N, &hr, &exp_diff); 
+    xs3_fft_dit_forward(x, FFT_N, &hr, &exp_diff); 
 
     // Aliased input BFP vectors
     bfp_complex_s32_t* a_fft = (bfp_complex_s32_t*) a;
@@ -209,11 +214,13 @@ void bfp_fft_forward_stereo(
     // the Channel B's time-domain signal into the imaginary part of a complex input vector. The
     // resulting complex spectrum contains a half-period of each of the two channels' spectra, but
     // in a jumbled up form. This function un-jumbles them.
-    hr = xs3_fft_spectra_split(scratch, FFT_N);
+    hr = xs3_fft_spectra_split(x, FFT_N);
 
-    // Copy the data from the scratch buffer back to the input buffers
-    xs3_vect_s32_copy((int32_t*) a_fft->data, (int32_t*) &scratch[0], FFT_N);
-    xs3_vect_s32_copy((int32_t*) b_fft->data, (int32_t*) &scratch[FFT_N/2], FFT_N);
+    // Copy the data from the scratch buffer back to the input buffers (if it was used)
+    if(x == scratch){
+        xs3_vect_s32_copy((int32_t*) a_fft->data, (int32_t*) &scratch[0], FFT_N);
+        xs3_vect_s32_copy((int32_t*) b_fft->data, (int32_t*) &scratch[FFT_N/2], FFT_N);
+    }
 
     //a and b might actually have different headroom, but the xs3_fft_spectra_split() only
     // computes the headroom of the entire FFT_N-element complex spectrum, which is the same
@@ -248,13 +255,21 @@ void  bfp_fft_inverse_stereo(
     // the length of a or b (which must have the same length)
     const unsigned FFT_N = 2*a_fft->length;
 
-    // 2 bits of headroom are required by xs3_fft_dit_inverse()
+    // If b_fft's data immediately follows a_fft's, the two spectra together are exactly the 
+    // complex input the IFFT needs, and the whole transform can be done in-place.
+    complex_s32_t* x = (b_fft->data == &a_fft->data[FFT_N/2])? a_fft->data : scratch;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(x != NULL);
+#endif
+
+    // 2 bits of headroom are required by xs3_fft_dif_inverse()
     right_shift_t a_shr = 2 - a_fft->hr;
     right_shift_t b_shr = 2 - b_fft->hr;
 
-    // Both input vectors need to be copied to the scratch buffer.
-    xs3_vect_complex_s32_shr(&scratch[0], a_fft->data, FFT_N/2, a_shr);
-    xs3_vect_complex_s32_shr(&scratch[FFT_N/2], b_fft->data, FFT_N/2, b_shr);
+    // Both input vectors need to be shifted into the complex buffer (which may be where they are).
+    xs3_vect_complex_s32_shr(&x[0], a_fft->data, FFT_N/2, a_shr);
+    xs3_vect_complex_s32_shr(&x[FFT_N/2], b_fft->data, FFT_N/2, b_shr);
     
     a_fft->exp += a_shr;
     b_fft->exp += b_shr;
@@ -267,20 +282,18 @@ void  bfp_fft_inverse_stereo(
 
     // Because the real, stereo IFFT is implemented using a complex FFT, the two channels'
     // spectra have to be jumbled together in a particular way prior to applying the IFFT
-    xs3_fft_spectra_merge(scratch, FFT_N);
-
-    // Undo the bit-reversed indexing
-    xs3_fft_index_bit_reversal(scratch, FFT_N);
+    xs3_fft_spectra_merge(x, FFT_N);
 
-    // Do the actual IFFT
-    xs3_fft_dit_inverse(scratch, FFT_N, &hr, &exp_diff);
+    // Do the actual IFFT. The decimation-in-frequency IFFT takes its input in natural order, and
+    // leaves its output in bit-reversed order.
+    xs3_fft_dif_inverse(x, FFT_N, &hr, &exp_diff);
 
     // Aliases for time-domain vectors
     bfp_s32_t* a = (bfp_s32_t*) a_fft;
     bfp_s32_t* b = (bfp_s32_t*) b_fft;
 
-    // Copy data back from scratch buffer
-    xs3_vect_s32_unzip(a->data, b->data, scratch, FFT_N);
+    // Undo the bit-reversed indexing and separate the channels, in one pass.
+    xs3_fft_unzip_bit_reversal(a->data, b->data, x, FFT_N);
 
     // Update vector metadata
     a->hr = b->hr = hr;
@@ -291,6 +304,46 @@ void  bfp_fft_inverse_stereo(
 }
 
 
+void bfp_fft_forward_multi(
+    bfp_s32_t channels[],
+    const unsigned channel_count,
+    complex_s32_t scratch[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(channel_count != 0);
+    for(int k = 1; k < channel_count; k++)
+        assert(channels[k].length == channels[0].length);
+#endif
+
+    // Each pair is split into its own two spectra straight after its FFT, while the pair's data is
+    // still in the working buffer, rather than all pairs being transformed and then all split.
+    for(int k = 0; k + 1 < channel_count; k += 2)
+        bfp_fft_forward_stereo(&channels[k], &channels[k+1], scratch);
+
+    if(channel_count & 1)
+        bfp_fft_forward_mono(&channels[channel_count-1]);
+}
+
+
+void bfp_fft_inverse_multi(
+    bfp_complex_s32_t spectra[],
+    const unsigned channel_count,
+    complex_s32_t scratch[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(channel_count != 0);
+    for(int k = 1; k < channel_count; k++)
+        assert(spectra[k].length == spectra[0].length);
+#endif
+
+    for(int k = 0; k + 1 < channel_count; k += 2)
+        bfp_fft_inverse_stereo(&spectra[k], &spectra[k+1], scratch);
+
+    if(channel_count & 1)
+        bfp_fft_inverse_mono(&spectra[channel_count-1]);
+}
+
+
 void bfp_fft_unpack_mono(
   bfp_complex_s32_t* x)
 {
@@ -311,3 +364,66 @@ void bfp_fft_pack_mono(
   // Move Nyquist component's real part to DC imaginary part
   x->data[0].im = x->data[x->length].re;
 }
+
+
+void bfp_s32_hilbert(
+    bfp_complex_s32_t* a,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    // Length must be 2^p where p is a non-negative integer
+    assert(b->length != 0);
+    // for a positive power of 2, subtracting 1 should increase its headroom.
+    assert(cls(b->length - 1) > cls(b->length)); 
+#endif
+
+    const unsigned FFT_N = b->length;
+
+    // The real FFT is computed in the first half of the output buffer, which is then extended
+    // into the full N-element analytic spectrum. (If b->data is already the start of a->data,
+    // this copy is a no-op)
+    bfp_s32_t x;
+    bfp_s32_init(&x, (int32_t*) a->data, b->exp, FFT_N, 0);
+    x.hr = b->hr;
+    xs3_vect_s32_copy(x.data, b->data, FFT_N);
+
+    bfp_complex_s32_t* X = bfp_fft_forward_mono(&x);
+
+    // The analytic spectrum is 2*X[f] for 0 < f < N/2, X[f] for f in {0, N/2} and 0 for the
+    // negative frequencies. Rather than doubling the positive-frequency bins we increment the 
+    // exponent, and halve the DC and Nyquist bins instead.
+    // The spectrum is still packed with X[N/2] in the imaginary part of X[0], so the Nyquist
+    // bin can be moved directly to its place in the full-length spectrum without unpacking.
+    a->data[FFT_N/2].re = X->data[0].im >> 1;
+    a->data[FFT_N/2].im = 0;
+    a->data[0].re = X->data[0].re >> 1;
+    a->data[0].im = 0;
+
+    xs3_vect_complex_s32_set(&a->data[FFT_N/2 + 1], 0, 0, FFT_N/2 - 1);
+
+    // Halving the DC and Nyquist bins and zeroing the upper half can only increase headroom, so the
+    // FFT's headroom is still a safe bound.
+    a->exp = X->exp + 1;
+    a->hr = X->hr;
+    a->length = FFT_N;
+
+    bfp_fft_inverse_complex(a);
+}
+
+
+void bfp_s32_envelope(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    complex_s32_t scratch[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS)
+    assert(a->length == b->length);
+#endif
+
+    bfp_complex_s32_t Z;
+    bfp_complex_s32_init(&Z, scratch, 0, b->length, 0);
+
+    bfp_s32_hilbert(&Z, b);
+
+    bfp_complex_s32_mag(a, &Z);
+}
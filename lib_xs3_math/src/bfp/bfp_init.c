@@ -81,6 +81,25 @@ void bfp_complex_s32_init(
 }
 
 
+void bfp_complex_s32_planar_init(
+    bfp_complex_s32_planar_t* a, 
+    int32_t* real_data,
+    int32_t* imag_data, 
+    const exponent_t exp, 
+    const unsigned length,
+    const unsigned calc_hr)
+{
+    a->real = real_data;
+    a->imag = imag_data;
+    a->length = length;
+    a->exp = exp;
+    a->flags = 0;
+
+    if(calc_hr) bfp_complex_s32_planar_headroom(a);
+    else        a->hr = 0;
+}
+
+
 
 void bfp_s16_set(
     bfp_s16_t* a,
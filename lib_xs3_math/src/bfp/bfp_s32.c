@@ -310,29 +310,39 @@ float_s64_t bfp_s32_abs_sum(
 }
 
 
-float_s32_t bfp_s32_mean(
-    const bfp_s32_t* b)
+/*
+ * Mean of `length` values given their 64-bit sum (with exponent sum_exp).
+ */
+static float_s32_t mean_from_sum(
+    int64_t sum,
+    const exponent_t sum_exp,
+    const unsigned length)
 {
-#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
-    assert(b->length != 0);
-#endif
-
     float_s32_t a;
-
-    int64_t sum = xs3_vect_s32_sum(b->data, b->length);
     
     headroom_t hr = HR_S64(sum);
     sum = sum << hr;
-    int64_t mean = sum / ((int)b->length);
+    int64_t mean = sum / ((int)length);
     right_shift_t shr = MAX(0, 32 - HR_S64(mean));
 
     if(shr > 0)
         mean += 1 << (shr-1);
     
     a.mant = mean >> shr;
-    a.exp = b->exp - hr + shr;
+    a.exp = sum_exp - hr + shr;
 
     return a;
+}
+
+
+float_s32_t bfp_s32_mean(
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+#endif
+
+    return mean_from_sum(xs3_vect_s32_sum(b->data, b->length), b->exp, b->length);
 
 }
 
@@ -520,3 +530,459 @@ void bfp_s32_convolve_same(
   a->exp = b->exp;
 
 }
+
+
+void bfp_s32_wiener_gain(
+    bfp_s32_t* a,
+    const bfp_s32_t* sig_pow,
+    const bfp_s32_t* noise_pow,
+    const int32_t gain_min)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(a->length == sig_pow->length);
+    assert(a->length == noise_pow->length);
+    assert(a->length != 0);
+#endif
+
+    right_shift_t sig_shr, noise_shr;
+
+    xs3_vect_s32_wiener_gain_prepare(&sig_shr, &noise_shr, sig_pow->exp, noise_pow->exp, 
+                                     sig_pow->hr, noise_pow->hr);
+
+    a->exp = -30;
+    a->hr = xs3_vect_s32_wiener_gain(a->data, sig_pow->data, noise_pow->data, a->length, 
+                                     sig_shr, noise_shr, gain_min);
+}
+
+
+void bfp_s32_wiener_gain_dd(
+    bfp_s32_t* a,
+    bfp_s32_t* clean_pow,
+    const bfp_s32_t* sig_pow,
+    const bfp_s32_t* noise_pow,
+    const int32_t alpha,
+    const int32_t gain_min)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(a->length == clean_pow->length);
+    assert(a->length == sig_pow->length);
+    assert(a->length == noise_pow->length);
+    assert(a->length != 0);
+    assert(alpha >= 0 && alpha <= 0x40000000);
+#endif
+
+    right_shift_t clean_shr, sig_shr, noise_shr;
+
+    xs3_vect_s32_wiener_gain_dd_prepare(&clean_pow->exp, &clean_shr, &sig_shr, &noise_shr, 
+                                        clean_pow->exp, sig_pow->exp, noise_pow->exp,
+                                        clean_pow->hr, sig_pow->hr, noise_pow->hr);
+
+    a->exp = -30;
+    a->hr = xs3_vect_s32_wiener_gain_dd(a->data, clean_pow->data, &clean_pow->hr, sig_pow->data, 
+                                        noise_pow->data, a->length, clean_shr, sig_shr, noise_shr, 
+                                        alpha, gain_min);
+}
+
+
+void bfp_s32_max_elementwise(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_s32_max_elementwise_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s32_max_elementwise(a->data, b->data, c->data, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s32_min_elementwise(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_s32_min_elementwise_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s32_min_elementwise(a->data, b->data, c->data, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s32_select(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c,
+    const int8_t mask[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == c->length);
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t b_shr, c_shr;
+
+    xs3_vect_s32_select_prepare(&a->exp, &b_shr, &c_shr, b->exp, c->exp, b->hr, c->hr);
+
+    a->hr = xs3_vect_s32_select(a->data, b->data, c->data, mask, b->length, b_shr, c_shr);
+}
+
+
+void bfp_s32_stats(
+    bfp_s32_stats_t* a,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+#endif
+
+    xs3_vect_s32_stats_t stats;
+    right_shift_t b_shr;
+
+    xs3_vect_s32_energy_prepare(&a->energy.exp, &b_shr, b->length, b->exp, b->hr);
+    xs3_vect_s32_stats(&stats, b->data, b->length, b_shr);
+
+    a->max.mant = stats.max;
+    a->max.exp = b->exp;
+    a->min.mant = stats.min;
+    a->min.exp = b->exp;
+    a->argmax = stats.argmax;
+    a->argmin = stats.argmin;
+    a->sum.mant = stats.sum;
+    a->sum.exp = b->exp;
+    a->mean = mean_from_sum(stats.sum, b->exp, b->length);
+    a->energy.mant = stats.energy;
+}
+
+
+/*
+ * Sum of squared deviations of b[] from its mean, which has exponent 2 * d_exp. The mean itself is
+ * given by  b->data[0] + mean_d * 2^(d_exp - b->exp)  (in units of 2^(b->exp)).
+ */
+static int64_t centred_sum_sq(
+    int64_t* mean_d,
+    exponent_t* d_exp,
+    const bfp_s32_t* b)
+{
+    right_shift_t b_shr;
+    int64_t sum, sum_sq;
+
+    xs3_vect_s32_moments_prepare(d_exp, &b_shr, b->length, b->exp, b->hr);
+    xs3_vect_s32_moments(&sum, &sum_sq, b->data, b->length, b->data[0], b_shr);
+
+    const int64_t N = b->length;
+    const int64_t m = (sum >= 0)? (sum + N/2) / N : -((N/2 - sum) / N);
+
+    // sum((d - m)^2)  =  sum_sq - m * sum + m * (N * m - sum)
+    // The last term is small because m is the rounded mean. This can't overflow, and is exact.
+    *mean_d = m;
+    return sum_sq - m * sum + m * (N * m - sum);
+}
+
+
+float_s32_t bfp_s32_variance(
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+#endif
+
+    int64_t mean_d;
+    exponent_t d_exp;
+    const int64_t S = centred_sum_sq(&mean_d, &d_exp, b);
+
+    return mean_from_sum(S, 2 * d_exp, b->length);
+}
+
+
+float_s32_t bfp_s32_std(
+    const bfp_s32_t* b)
+{
+    return float_s32_sqrt(bfp_s32_variance(b));
+}
+
+
+void bfp_s32_normalize(
+    bfp_s32_t* a,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    const unsigned length = b->length;
+    const exponent_t b_exp = b->exp;
+    const int32_t pivot = b->data[0];
+
+    int64_t mean_d;
+    exponent_t d_exp;
+    const int64_t S = centred_sum_sq(&mean_d, &d_exp, b);
+
+    // No z-score can exceed sqrt(length) in magnitude.
+    const exponent_t a_exp = -30 + (ceil_log2(length) + 1) / 2;
+
+    if(S == 0){
+        bfp_s32_set(a, 0, a_exp);
+        return;
+    }
+
+    const float_s32_t std = float_s32_sqrt(mean_from_sum(S, 2 * d_exp, length));
+
+    // 1/std, with exactly 1 bit of headroom so that the products can't overflow.
+    exponent_t scale_exp;
+    int32_t scale = xs3_s32_inverse(&scale_exp, std.mant);
+    scale_exp -= std.exp;
+
+    const left_shift_t scale_shl = HR_S32(scale) - 1;
+    scale = (scale_shl >= 0)? (scale << scale_shl) : (scale >> -scale_shl);
+    scale_exp -= scale_shl;
+
+    // -(mean * scale), with exponent b_exp + scale_exp
+    const left_shift_t d_shl = d_exp - b_exp;
+    const int64_t mean_d_scaled = mean_d * scale;
+    const int64_t offset = -(((int64_t)pivot) * scale
+                            + ((d_shl >= 0)? (mean_d_scaled << d_shl) 
+                                           : (((mean_d_scaled >> (-d_shl-1)) + 1) >> 1)));
+
+    a->hr = xs3_vect_s32_affine(a->data, b->data, length, scale, offset, a_exp - (b_exp + scale_exp));
+    a->exp = a_exp;
+}
+
+
+void bfp_s32_topk(
+    unsigned indices[],
+    float_s32_t values[],
+    const bfp_s32_t* b,
+    const unsigned K)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(K <= b->length);
+#endif
+
+    xs3_vect_s32_topk(indices, NULL, b->data, b->length, K);
+
+    if(values != NULL){
+        for(int k = 0; k < K; k++){
+            values[k].mant = b->data[indices[k]];
+            values[k].exp = b->exp;
+        }
+    }
+}
+
+
+// Number of histogram bins used by bfp_s32_percentile() to narrow down the quickselect
+#define PERCENTILE_BINS_LOG2    (6)
+#define PERCENTILE_BINS         (1 << PERCENTILE_BINS_LOG2)
+
+float_s32_t bfp_s32_percentile(
+    const bfp_s32_t* b,
+    const fixed_s32_t p,
+    int32_t scratch[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+    assert(p >= 0 && p <= 0x40000000);
+#endif
+
+    const unsigned length = b->length;
+    const unsigned rank = (((int64_t)p) * (length - 1)) >> 30;
+
+    // The bins cover the whole range allowed by the headroom, [-2^(31-hr), 2^(31-hr)).
+    const headroom_t hr = MIN(b->hr, 31);
+    const int32_t lower = (int32_t) -(((int64_t)1) << (31 - hr));
+    const right_shift_t bin_shr = MAX(32 - hr - PERCENTILE_BINS_LOG2, 0);
+
+    unsigned counts[PERCENTILE_BINS];
+    xs3_vect_s32_histogram(counts, b->data, length, PERCENTILE_BINS, lower, bin_shr);
+
+    unsigned bin = 0;
+    unsigned below = 0;
+    while(below + counts[bin] <= rank)
+        below += counts[bin++];
+
+    // Gather that bin's elements. Bin edges are found the same way as xs3_vect_s32_histogram().
+    unsigned count = 0;
+    for(int k = 0; k < length; k++){
+        const int64_t d = ((int64_t)b->data[k]) - lower;
+        int64_t j = (d < 0)? 0 : (d >> bin_shr);
+        j = MIN(j, PERCENTILE_BINS - 1);
+        if(j == bin)
+            scratch[count++] = b->data[k];
+    }
+
+    float_s32_t a;
+    a.mant = xs3_vect_s32_nth_element(scratch, count, rank - below);
+    a.exp = b->exp;
+    return a;
+}
+
+
+void bfp_s32_softclip(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const softclip_curve_e curve)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    a->hr = xs3_vect_s32_softclip(a->data, b->data, b->length, -30 - b->exp, curve);
+    a->exp = -30;
+}
+
+
+void bfp_s32_cumsum(
+    bfp_s32_t* a,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length == a->length);
+    assert(b->length != 0);
+#endif
+
+    right_shift_t a_shr;
+
+    xs3_vect_s32_cumsum_prepare(&a->exp, &a_shr, b->length, b->exp, b->hr);
+
+    a->hr = xs3_vect_s32_cumsum(a->data, b->data, b->length, a_shr);
+}
+
+
+void bfp_s32_pyramid(
+    bfp_s32_t* max,
+    bfp_s32_t* min,
+    bfp_s32_t* mean_sq,
+    const bfp_s32_t* b,
+    const unsigned levels)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(levels != 0);
+    assert(b->length != 0);
+    assert((b->length & ((1 << levels) - 1)) == 0);
+    assert(max->length == b->length - (b->length >> levels));
+    assert(min->length == max->length);
+    assert(mean_sq->length == max->length);
+#endif
+
+    // Largest possible square is 2^(62 - 2*b_hr); this puts it at 2^30.
+    const right_shift_t sq_shr = 32 - 2 * ((int) b->hr);
+
+    xs3_vect_s32_pyramid(max->data, min->data, mean_sq->data, b->data, b->length, levels, sq_shr);
+
+    max->exp = b->exp;
+    min->exp = b->exp;
+    mean_sq->exp = 2 * b->exp + sq_shr;
+
+    max->hr = xs3_vect_s32_headroom(max->data, max->length);
+    min->hr = xs3_vect_s32_headroom(min->data, min->length);
+    mean_sq->hr = xs3_vect_s32_headroom(mean_sq->data, mean_sq->length);
+}
+
+
+float_s64_t bfp_s32_energy_zcr(
+    unsigned* zero_crossings,
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+#endif
+
+    float_s64_t a;
+    right_shift_t b_shr;
+    xs3_vect_s32_energy_prepare(&a.exp, &b_shr, b->length, b->exp, b->hr);
+    a.mant = xs3_vect_s32_energy_zcr(zero_crossings, b->data, b->length, b_shr);
+    return a;
+}
+
+
+fixed_s32_t bfp_s32_spectral_flatness(
+    const bfp_s32_t* b)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(b->length != 0);
+#endif
+
+    return xs3_vect_s32_spectral_flatness(b->data, b->length);
+}
+
+
+void bfp_s32_delay_and_sum(
+    bfp_s32_t* a,
+    const bfp_s32_t b[],
+    const fixed_s32_t gain_q30[],
+    const unsigned delay[],
+    const unsigned channels)
+{
+    assert(channels <= XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS);
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(channels != 0);
+    for(int i = 0; i < channels; i++)
+        assert(b[i].length >= a->length + delay[i]);
+#endif
+
+    const int32_t* b_data[XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS];
+    exponent_t b_exp[XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS];
+    headroom_t b_hr[XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS];
+    right_shift_t b_shr[XS3_BFP_DELAY_AND_SUM_MAX_CHANNELS];
+
+    for(int i = 0; i < channels; i++){
+        b_data[i] = &b[i].data[b[i].length - a->length - delay[i]];
+        b_exp[i] = b[i].exp;
+        b_hr[i] = b[i].hr;
+    }
+
+    right_shift_t a_shr;
+    xs3_vect_s32_weighted_sum_prepare(&a->exp, b_shr, &a_shr, b_exp, b_hr, gain_q30, channels);
+
+    a->hr = xs3_vect_s32_weighted_sum(a->data, b_data, gain_q30, b_shr, channels, a->length, a_shr);
+}
+
+
+void bfp_s32_smooth(
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const fixed_s32_t coef_q30)
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(y->length == x->length);
+    assert(y->length != 0);
+#endif
+
+    right_shift_t y_shr, x_shr;
+    xs3_vect_s32_smooth_prepare(&y->exp, &y_shr, &x_shr, y->exp, x->exp, y->hr, x->hr);
+
+    y->hr = xs3_vect_s32_smooth(y->data, x->data, coef_q30, y->length, y_shr, x_shr);
+}
+
+
+void bfp_s32_smooth_vect(
+    bfp_s32_t* y,
+    const bfp_s32_t* x,
+    const fixed_s32_t coef_q30[])
+{
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(y->length == x->length);
+    assert(y->length != 0);
+#endif
+
+    right_shift_t y_shr, x_shr;
+    xs3_vect_s32_smooth_prepare(&y->exp, &y_shr, &x_shr, y->exp, x->exp, y->hr, x->hr);
+
+    y->hr = xs3_vect_s32_smooth_vect(y->data, x->data, coef_q30, y->length, y_shr, x_shr);
+}
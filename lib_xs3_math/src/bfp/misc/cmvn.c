@@ -0,0 +1,107 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+
+void bfp_cmvn_s32_init(
+    bfp_cmvn_s32_t* cmvn,
+    int32_t buffer[],
+    const unsigned dims,
+    const fixed_s32_t alpha,
+    const float_s32_t var_floor)
+{
+    assert(dims != 0);
+    assert(alpha >= 0 && alpha <= 0x40000000);
+    assert(var_floor.mant > 0);
+
+    cmvn->alpha = alpha;
+    cmvn->var_floor = var_floor;
+    cmvn->frames = 0;
+
+    bfp_s32_init(&cmvn->mean,    &buffer[0 * dims], 0, dims, 0);
+    bfp_s32_init(&cmvn->var,     &buffer[1 * dims], 0, dims, 0);
+    bfp_s32_init(&cmvn->scratch, &buffer[2 * dims], 0, dims, 0);
+}
+
+
+/*
+ * a = b + c, for non-negative b and positive c. This is a single pass of xs3_vect_s32_affine() with a
+ * scale of 1, so c is added as a 64-bit offset rather than first being rounded to the output exponent.
+ */
+static void add_floor(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const float_s32_t c)
+{
+    const exponent_t a_exp = MAX(b->exp - (int) b->hr, c.exp - (int) HR_S32(c.mant)) + 1;
+
+    // b and c are added at exponent p, which leaves both terms (and the sum) below 2^62. If p is 
+    // coarser than b's exponent, b is less than half an LSB of the output, and is dropped.
+    const exponent_t p = MAX(b->exp - 30, a_exp - 32);
+    const int32_t scale = (b->exp >= p)? (1 << (b->exp - p)) : 0;
+
+    const left_shift_t c_shl = c.exp - p;
+    const int64_t offset = (c_shl >= 0)? (((int64_t) c.mant) << c_shl)
+                         : (c_shl < -32)? 0
+                         : (((((int64_t) c.mant) >> (-c_shl-1)) + 1) >> 1);
+
+    a->hr = xs3_vect_s32_affine(a->data, b->data, b->length, scale, offset, a_exp - p);
+    a->exp = a_exp;
+}
+
+
+void bfp_cmvn_s32_update(
+    bfp_s32_t* a,
+    bfp_cmvn_s32_t* cmvn,
+    const bfp_s32_t* x)
+{
+    bfp_s32_t* mean = &cmvn->mean;
+    bfp_s32_t* var = &cmvn->var;
+    bfp_s32_t* scratch = &cmvn->scratch;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(x->length == mean->length);
+    assert(a->length == mean->length);
+#endif
+
+    // Smoothing coefficient of the one-pole smoothers, 1 - alpha
+    const fixed_s32_t coef = 0x40000000 - cmvn->alpha;
+
+    if(cmvn->frames == 0){
+        memcpy(mean->data, x->data, x->length * sizeof(int32_t));
+        mean->exp = x->exp;
+        mean->hr = x->hr;
+        bfp_s32_set(var, 0, 2 * x->exp);
+    } else {
+        // D = X - M, then M += (1 - alpha) * D
+        bfp_s32_sub(scratch, x, mean);
+        bfp_s32_smooth(mean, x, coef);
+    }
+
+    // X - M with the updated mean is alpha * D. x is not used again once a has been written, so this
+    // is safe in-place.
+    bfp_s32_sub(a, x, mean);
+
+    // Exponentially weighted form of Welford's update: V = alpha * (V + (1 - alpha) * D^2), which is the 
+    // one-pole smoother V += (1 - alpha) * (alpha * D^2 - V). Only deviations from the mean are squared,
+    // so there is no cancellation between large mean-square and squared-mean terms.
+    if(cmvn->frames != 0){
+        bfp_s32_mul(scratch, scratch, a);
+        bfp_s32_smooth(var, scratch, coef);
+    }
+
+    cmvn->frames = 1;
+
+    // 1 / sqrt(V + eps)
+    add_floor(scratch, var, cmvn->var_floor);
+    bfp_s32_sqrt(scratch, scratch);
+    bfp_s32_inverse(scratch, scratch);
+
+    bfp_s32_mul(a, a, scratch);
+}
@@ -0,0 +1,191 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+
+// Levels and gains are base-2 logarithms in Q8.24
+#define LOG2_FRAC_BITS      (24)
+#define LOG2_ONE            (((int32_t)1) << LOG2_FRAC_BITS)
+
+// Level used for a silent frame, and the lowest gain that will be applied.
+#define LOG2_FLOOR          (-120 * LOG2_ONE)
+
+
+// 2^(2^-i) in Q2.30, for i = 1, 2, ..., LOG2_FRAC_BITS
+static const int32_t exp2_frac_table[LOG2_FRAC_BITS] = {
+    1518500250, 1276901417, 1170923762, 1121280436, 1097253708, 1085434106, 1079572136, 1076653033,
+    1075196443, 1074468888, 1074105294, 1073923544, 1073832680, 1073787251, 1073764537, 1073753181,
+    1073747502, 1073744663, 1073743244, 1073742534, 1073742179, 1073742001, 1073741913, 1073741868,
+};
+
+
+/*
+ * log2(x) in Q8.24, for positive x.
+ * 
+ * The fractional bits are found one at a time by repeatedly squaring the normalized mantissa.
+ */
+static int32_t log2_float_s32(
+    const float_s32_t x)
+{
+    // Normalize the mantissa to [2^30, 2^31), i.e. [1, 2) in Q1.30
+    const headroom_t hr = HR_S32(x.mant);
+    int64_t m = ((int64_t)x.mant) << hr;
+
+    int64_t result = ((int64_t)(x.exp + 30 - hr)) * LOG2_ONE;
+
+    for(int i = 1; i <= LOG2_FRAC_BITS; i++){
+        m = (m * m) >> 30;
+        if(m >= (((int64_t)1) << 31)){
+            m >>= 1;
+            result += ((int32_t)1) << (LOG2_FRAC_BITS - i);
+        }
+    }
+
+    return (int32_t) MAX(result, LOG2_FLOOR);
+}
+
+
+/*
+ * 2^x, for x in Q8.24.
+ */
+static float_s32_t exp2_float_s32(
+    const int32_t x)
+{
+    float_s32_t a;
+    int64_t m = ((int32_t)1) << 30;
+
+    for(int i = 1; i <= LOG2_FRAC_BITS; i++){
+        if(x & (((int32_t)1) << (LOG2_FRAC_BITS - i)))
+            m = (m * exp2_frac_table[i-1] + (1 << 29)) >> 30;
+    }
+
+    a.mant = (int32_t) m;
+    a.exp = (x >> LOG2_FRAC_BITS) - 30;
+    return a;
+}
+
+
+/*
+ * Gain required for a frame with level `level` (both Q8.24).
+ */
+static int32_t gain_curve(
+    const bfp_compressor_s32_t* comp,
+    const int32_t level)
+{
+    const int64_t d = ((int64_t)comp->threshold) - level;
+    const fixed_s32_t slope = (d < 0)? comp->slope_above : comp->slope_below;
+    const int64_t g = (d * slope) >> 30;
+
+    return (int32_t) MAX(MIN(g, comp->max_gain), LOG2_FLOOR);
+}
+
+
+void bfp_compressor_s32_init(
+    bfp_compressor_s32_t* comp,
+    int32_t buffer[],
+    const unsigned frame_length,
+    const float_s32_t threshold,
+    const fixed_s32_t slope_above,
+    const fixed_s32_t slope_below,
+    const float_s32_t max_gain,
+    const fixed_s32_t attack,
+    const fixed_s32_t release)
+{
+    assert(frame_length != 0);
+    assert(threshold.mant > 0);
+    assert(max_gain.mant > 0);
+    assert(slope_above >= 0 && slope_above <= 0x40000000);
+    assert(slope_below >= 0 && slope_below <= 0x40000000);
+    assert(attack >= 0 && attack <= 0x40000000);
+    assert(release >= 0 && release <= 0x40000000);
+
+    comp->frame_length = frame_length;
+    comp->threshold = log2_float_s32(threshold);
+    comp->slope_above = slope_above;
+    comp->slope_below = slope_below;
+    comp->max_gain = log2_float_s32(max_gain);
+    comp->attack = attack;
+    comp->release = release;
+    comp->required = gain_curve(comp, LOG2_FLOOR);
+    comp->gain = 0;
+    comp->current = 0;
+
+    bfp_s32_init(&comp->delay[0], &buffer[0 * frame_length], 0, frame_length, 0);
+    bfp_s32_init(&comp->delay[1], &buffer[1 * frame_length], 0, frame_length, 0);
+    bfp_s32_init(&comp->ramp,     &buffer[2 * frame_length], 0, frame_length, 0);
+
+    bfp_s32_set(&comp->delay[0], 0, 0);
+}
+
+
+void bfp_compressor_s32_update(
+    bfp_s32_t* a,
+    bfp_compressor_s32_t* comp,
+    const bfp_s32_t* x)
+{
+    const unsigned N = comp->frame_length;
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(x->length == N);
+    assert(a->length == N);
+#endif
+
+    // Level of the new frame
+    const int32_t x_max = xs3_vect_s32_max(x->data, N);
+    const int32_t x_min = xs3_vect_s32_min(x->data, N);
+    const float_s32_t peak = { 
+        .mant = MAX(x_max, (x_min == INT32_MIN)? INT32_MAX : -x_min), 
+        .exp = x->exp };
+
+    const int32_t level = (peak.mant > 0)? log2_float_s32(peak) : LOG2_FLOOR;
+    const int32_t required = gain_curve(comp, level);
+
+    // The output frame's gain mustn't exceed what either it or (via the look-ahead) the next 
+    // frame requires, so that the ramp towards the next frame's gain is complete in time.
+    const int32_t target = MIN(comp->required, required);
+    const fixed_s32_t coef = (target < comp->gain)? comp->attack : comp->release;
+    const int32_t gain = comp->gain 
+        + (int32_t)((((int64_t)(0x40000000 - coef)) * (((int64_t)target) - comp->gain)) >> 30);
+
+    // Linear gain ramp across the output frame, from the previous gain to the new one. The two
+    // end points are given a common exponent with 1 bit of headroom.
+    float_s32_t g0 = exp2_float_s32(comp->gain);
+    float_s32_t g1 = exp2_float_s32(gain);
+    const exponent_t g_exp = MAX(g0.exp, g1.exp) + 1;
+    const right_shift_t g0_shr = g_exp - g0.exp;
+    const right_shift_t g1_shr = g_exp - g1.exp;
+    g0.mant = (g0_shr >= 31)? 0 : (g0.mant >> g0_shr);
+    g1.mant = (g1_shr >= 31)? 0 : (g1.mant >> g1_shr);
+
+    bfp_s32_t* ramp = &comp->ramp;
+    const int64_t step = (((int64_t)(g1.mant - g0.mant)) << 16) / N;
+    int64_t acc = 0;
+
+    for(int k = 0; k < N - 1; k++){
+        acc += step;
+        ramp->data[k] = g0.mant + (int32_t)(acc >> 16);
+    }
+    ramp->data[N-1] = g1.mant;
+    ramp->exp = g_exp;
+    ramp->hr = HR_S32(MAX(g0.mant, g1.mant));
+
+    // The new frame is copied into the delay before the output is written, in case a == x.
+    bfp_s32_t* out_frame = &comp->delay[comp->current];
+    bfp_s32_t* in_frame = &comp->delay[1 - comp->current];
+
+    memcpy(in_frame->data, x->data, N * sizeof(int32_t));
+    in_frame->exp = x->exp;
+    in_frame->hr = x->hr;
+
+    bfp_s32_mul(a, out_frame, ramp);
+
+    comp->current = 1 - comp->current;
+    comp->required = required;
+    comp->gain = gain;
+}
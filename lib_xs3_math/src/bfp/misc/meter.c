@@ -0,0 +1,106 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+
+void bfp_meter_s32_init(
+    bfp_meter_s32_t* meter,
+    bfp_meter_s32_channel_t state[],
+    const unsigned channels,
+    const unsigned frame_length,
+    const unsigned hold_frames,
+    const fixed_s32_t peak_decay,
+    const fixed_s32_t rms_coef)
+{
+    assert(channels != 0);
+    assert(frame_length != 0);
+    assert(peak_decay >= 0 && peak_decay <= 0x40000000);
+    assert(rms_coef >= 0 && rms_coef <= 0x40000000);
+
+    meter->channels = channels;
+    meter->frame_length = frame_length;
+    meter->hold_frames = hold_frames;
+    meter->peak_decay = peak_decay;
+    meter->rms_coef = rms_coef;
+    meter->state = state;
+
+    meter->frame_length_inv.mant = xs3_s32_inverse(&meter->frame_length_inv.exp, frame_length);
+
+    for(int c = 0; c < channels; c++){
+        state[c].peak.mant = 0;
+        state[c].peak.exp = 0;
+        state[c].mean_square.mant = 0;
+        state[c].mean_square.exp = 0;
+        state[c].hold = 0;
+    }
+}
+
+
+void bfp_meter_s32_update(
+    bfp_meter_s32_t* meter,
+    const bfp_s32_t frame[])
+{
+    const float_s32_t decay = { .mant = meter->peak_decay, .exp = -30 };
+
+    for(int c = 0; c < meter->channels; c++){
+        const bfp_s32_t* x = &frame[c];
+        bfp_meter_s32_channel_t* state = &meter->state[c];
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+        assert(x->length == meter->frame_length);
+#endif
+
+        // Peak and energy of this channel's frame, in one pass
+        float_s32_t frame_peak;
+        float_s64_t energy;
+        right_shift_t x_shr;
+
+        xs3_vect_s32_energy_prepare(&energy.exp, &x_shr, x->length, x->exp, x->hr);
+        frame_peak.mant = xs3_vect_s32_abs_max_energy(&energy.mant, x->data, x->length, x_shr);
+        frame_peak.exp = x->exp;
+
+        // Held peak expires into a decaying peak. A zero peak is left alone so that its exponent
+        // doesn't run away during silence.
+        if(state->hold){
+            state->hold--;
+        } else if(state->peak.mant != 0){
+            state->peak = float_s32_mul(state->peak, decay);
+        }
+
+        if(float_s32_gte(frame_peak, state->peak)){
+            state->peak = frame_peak;
+            state->hold = meter->hold_frames;
+        }
+
+        // Smoothed mean-square level
+        float_s32_t frame_ms;
+        frame_ms.mant = xs3_scalar_s64_to_s32(&frame_ms.exp, energy.mant, energy.exp);
+        frame_ms = float_s32_mul(frame_ms, meter->frame_length_inv);
+
+        if(frame_ms.mant != 0 || state->mean_square.mant != 0)
+            state->mean_square = float_s32_ema(state->mean_square, frame_ms, meter->rms_coef);
+    }
+}
+
+
+float_s32_t bfp_meter_s32_peak(
+    const bfp_meter_s32_t* meter,
+    const unsigned channel)
+{
+    assert(channel < meter->channels);
+    return meter->state[channel].peak;
+}
+
+
+float_s32_t bfp_meter_s32_rms(
+    const bfp_meter_s32_t* meter,
+    const unsigned channel)
+{
+    assert(channel < meter->channels);
+    return float_s32_sqrt(meter->state[channel].mean_square);
+}
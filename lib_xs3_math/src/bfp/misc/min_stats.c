@@ -0,0 +1,126 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+
+/*
+ * Element-wise minimum of two non-negative BFP vectors.
+ *
+ * Because the elements are non-negative, the result can be no larger than the smaller of the two
+ * vectors' maxima, so the finer of the two vectors' exponents is used for the output (rather than
+ * the one chosen by xs3_vect_s32_min_elementwise_prepare()). Elements of the other vector may
+ * saturate when shifted, but any saturated element cannot be the minimum.
+ */
+static void bfp_s32_min_elementwise_nonneg(
+    bfp_s32_t* a,
+    const bfp_s32_t* b,
+    const bfp_s32_t* c)
+{
+    // An all-zero vector (e.g. a silent frame) shouldn't drag the exponent down.
+    const unsigned b_zero = (b->hr >= 31);
+    const unsigned c_zero = (c->hr >= 31);
+    const exponent_t a_exp = (b_zero && c_zero)? MIN(b->exp, c->exp)
+                           : b_zero?             c->exp - c->hr
+                           : c_zero?             b->exp - b->hr
+                           :                     MIN(b->exp - b->hr, c->exp - c->hr);
+    const right_shift_t b_shr = a_exp - b->exp;
+    const right_shift_t c_shr = a_exp - c->exp;
+
+    a->hr = xs3_vect_s32_min_elementwise(a->data, b->data, c->data, b->length, b_shr, c_shr);
+    a->exp = a_exp;
+}
+
+
+void bfp_min_stats_s32_init(
+    bfp_min_stats_s32_t* tracker,
+    bfp_s32_t subwin_min[],
+    int32_t buffer[],
+    const unsigned bins,
+    const unsigned subwin_count,
+    const unsigned subwin_frames)
+{
+    assert(bins != 0);
+    assert(subwin_count >= 2);
+    assert(subwin_frames != 0);
+
+    tracker->subwin_count = subwin_count;
+    tracker->subwin_frames = subwin_frames;
+    tracker->frame = 0;
+    tracker->head = 0;
+    tracker->filled = 0;
+    tracker->subwin_min = subwin_min;
+
+    for(int k = 0; k < subwin_count; k++)
+        bfp_s32_init(&subwin_min[k], &buffer[k * bins], 0, bins, 0);
+
+    bfp_s32_init(&tracker->window_min, &buffer[subwin_count * bins], 0, bins, 0);
+}
+
+
+void bfp_min_stats_s32_update(
+    bfp_s32_t* noise_floor,
+    bfp_min_stats_s32_t* tracker,
+    const bfp_s32_t* power)
+{
+    bfp_s32_t* current = &tracker->subwin_min[tracker->head];
+
+#if (XS3_BFP_DEBUG_CHECK_LENGTHS) // See xs3_math_conf.h
+    assert(power->length == current->length);
+    assert(noise_floor->length == current->length);
+#endif
+
+    // Update the running minimum of the current sub-window. The first frame of a sub-window
+    // simply replaces the slot's contents, which belong to the expired oldest sub-window.
+    if(tracker->frame == 0){
+        memcpy(current->data, power->data, power->length * sizeof(int32_t));
+        current->exp = power->exp;
+        current->hr = power->hr;
+    } else {
+        bfp_s32_min_elementwise_nonneg(current, current, power);
+    }
+
+    // The noise floor is the minimum over the current sub-window and all completed sub-windows.
+    if(tracker->filled == 0){
+        memcpy(noise_floor->data, current->data, current->length * sizeof(int32_t));
+        noise_floor->exp = current->exp;
+        noise_floor->hr = current->hr;
+    } else {
+        bfp_s32_min_elementwise_nonneg(noise_floor, current, &tracker->window_min);
+    }
+
+    if(++tracker->frame < tracker->subwin_frames)
+        return;
+
+    // The current sub-window is complete. Advance the head onto the oldest sub-window, which now
+    // expires, and recompute the minimum over the remaining completed sub-windows. This is the
+    // only place that more than a constant number of passes over the bins happens, and it happens
+    // once every subwin_frames frames.
+    tracker->frame = 0;
+    tracker->head = (tracker->head + 1 == tracker->subwin_count)? 0 : tracker->head + 1;
+
+    if(tracker->filled < tracker->subwin_count - 1)
+        tracker->filled++;
+
+    bfp_s32_t* window_min = &tracker->window_min;
+
+    for(int k = 1; k <= tracker->filled; k++){
+        unsigned dex = tracker->head + tracker->subwin_count - k;
+        if(dex >= tracker->subwin_count) dex -= tracker->subwin_count;
+
+        const bfp_s32_t* sub = &tracker->subwin_min[dex];
+
+        if(k == 1){
+            memcpy(window_min->data, sub->data, sub->length * sizeof(int32_t));
+            window_min->exp = sub->exp;
+            window_min->hr = sub->hr;
+        } else {
+            bfp_s32_min_elementwise_nonneg(window_min, window_min, sub);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include "bfp_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include <assert.h>
+#include <stdio.h>
+
+
+void bfp_window_s32_init(
+    bfp_window_s32_t* win,
+    int32_t buffer[],
+    const unsigned window,
+    const exponent_t exp)
+{
+    assert(window != 0);
+
+    win->window = window;
+    win->filled = 0;
+    win->head = 0;
+    win->exp = exp;
+    // Squares are at most 2^62, so this shift keeps the sum of `window` of them below 2^63.
+    win->energy_shr = ceil_log2(window);
+    win->sum = 0;
+    win->energy = 0;
+    win->history = &buffer[0];
+    win->max_deque = (unsigned*) &buffer[window];
+    win->min_deque = (unsigned*) &buffer[2 * window];
+    win->max_front = 0;
+    win->max_count = 0;
+    win->min_front = 0;
+    win->min_count = 0;
+}
+
+
+void bfp_window_s32_push(
+    bfp_window_s32_t* win,
+    const bfp_s32_t* x)
+{
+    const unsigned W = win->window;
+    const right_shift_t x_shr = win->exp - x->exp;
+
+    for(int k = 0; k < x->length; k++){
+        const int32_t sample = vlashr32(x->data[k], x_shr);
+        const unsigned pos = win->head;
+
+        // The sample at `pos` (if any) leaves the window, along with any deque entries for it. Such
+        // an entry can only be at the front, because it is the oldest.
+        if(win->filled == W){
+            const int64_t old = win->history[pos];
+            win->sum -= old;
+            win->energy -= (old * old) >> win->energy_shr;
+
+            if(win->max_count && win->max_deque[win->max_front] == pos){
+                win->max_front = (win->max_front + 1 == W)? 0 : win->max_front + 1;
+                win->max_count--;
+            }
+            if(win->min_count && win->min_deque[win->min_front] == pos){
+                win->min_front = (win->min_front + 1 == W)? 0 : win->min_front + 1;
+                win->min_count--;
+            }
+        } else {
+            win->filled++;
+        }
+
+        win->history[pos] = sample;
+        win->sum += sample;
+        win->energy += (((int64_t)sample) * sample) >> win->energy_shr;
+
+        // Entries at the back which can never again be the max (min) are discarded.
+        unsigned back;
+
+        while(win->max_count){
+            back = win->max_front + win->max_count - 1;
+            back = (back >= W)? back - W : back;
+            if(win->history[win->max_deque[back]] > sample) break;
+            win->max_count--;
+        }
+        back = win->max_front + win->max_count++;
+        win->max_deque[(back >= W)? back - W : back] = pos;
+
+        while(win->min_count){
+            back = win->min_front + win->min_count - 1;
+            back = (back >= W)? back - W : back;
+            if(win->history[win->min_deque[back]] < sample) break;
+            win->min_count--;
+        }
+        back = win->min_front + win->min_count++;
+        win->min_deque[(back >= W)? back - W : back] = pos;
+
+        win->head = (pos + 1 == W)? 0 : pos + 1;
+    }
+}
+
+
+float_s64_t bfp_window_s32_sum(
+    const bfp_window_s32_t* win)
+{
+    float_s64_t a = { .mant = win->sum, .exp = win->exp };
+    return a;
+}
+
+
+float_s32_t bfp_window_s32_mean(
+    const bfp_window_s32_t* win)
+{
+    assert(win->filled != 0);
+
+    float_s32_t sum, inv;
+    sum.mant = xs3_scalar_s64_to_s32(&sum.exp, win->sum, win->exp);
+    inv.mant = xs3_s32_inverse(&inv.exp, win->filled);
+    return float_s32_mul(sum, inv);
+}
+
+
+float_s64_t bfp_window_s32_energy(
+    const bfp_window_s32_t* win)
+{
+    float_s64_t a = { .mant = win->energy, .exp = 2 * win->exp + win->energy_shr };
+    return a;
+}
+
+
+float_s32_t bfp_window_s32_max(
+    const bfp_window_s32_t* win)
+{
+    assert(win->max_count != 0);
+
+    float_s32_t a = { .mant = win->history[win->max_deque[win->max_front]], .exp = win->exp };
+    return a;
+}
+
+
+float_s32_t bfp_window_s32_min(
+    const bfp_window_s32_t* win)
+{
+    assert(win->min_count != 0);
+
+    float_s32_t a = { .mant = win->history[win->min_deque[win->min_front]], .exp = win->exp };
+    return a;
+}
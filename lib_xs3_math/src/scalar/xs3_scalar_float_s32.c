@@ -11,7 +11,9 @@
 
 static inline int32_t ashr32(int32_t x, right_shift_t shr)
 {
-  if(shr >= 0)
+  if(shr >= 32)
+    return (x < 0)? -1 : 0;
+  else if(shr >= 0)
     return x >> shr;
   
   int64_t tmp = ((int64_t)x) << -shr;
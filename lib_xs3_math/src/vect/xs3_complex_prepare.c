@@ -295,10 +295,14 @@ void xs3_vect_complex_s32_real_mul_prepare(
 
     right_shift_t total_shr = 1 - total_hr;
 
-    if(b_hr <= c_hr)
-        *b_shr = total_shr - (total_shr >> 1);
-    else 
-        *b_shr = (total_shr >> 1);
+    if(total_shr < 0){
+        *b_shr = MAX(total_shr, ((int)-b_hr));
+    } else {
+        if(b_hr <= c_hr)
+            *b_shr = total_shr - (total_shr >> 1);
+        else 
+            *b_shr = (total_shr >> 1);
+    }
 
     *c_shr = total_shr - *b_shr;
     *a_exp = b_exp + c_exp + *b_shr + *c_shr + 30;
@@ -0,0 +1,132 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+#define DELAY_FRAC_BITS     16
+#define Q30_ONE             (((int64_t)1) << 30)
+
+#define MUL_Q30(X, Y)       ((((int64_t)(X)) * (Y) + (1<<29)) >> 30)
+
+
+void xs3_delay_s32_init(
+    xs3_delay_s32_t* delay,
+    int32_t buffer[],
+    const unsigned length)
+{
+    assert(length != 0);
+    delay->length = length;
+    delay->head = 0;
+    delay->buffer = buffer;
+    memset(buffer, 0, length * sizeof(int32_t));
+}
+
+
+void xs3_delay_s32_write(
+    xs3_delay_s32_t* delay,
+    const int32_t input[],
+    const unsigned count)
+{
+    assert(count <= delay->length);
+
+    // At most two contiguous segments of the ring are written
+    const unsigned first = MIN(count, delay->length - delay->head);
+
+    memcpy(&delay->buffer[delay->head], &input[0], first * sizeof(int32_t));
+    memcpy(&delay->buffer[0], &input[first], (count - first) * sizeof(int32_t));
+
+    delay->head += count;
+    if(delay->head >= delay->length)
+        delay->head -= delay->length;
+}
+
+
+/*
+    3rd order Lagrange weights for the 4 samples surrounding the read position, computed once per tap per block
+    from their product formulas. With mu the fractional part of the delay, the weights applied to x[P+1], x[P], 
+    x[P-1] and x[P-2] (P being the sample at the integer part of the delay) are:
+
+        h[0] = -mu (mu-1) (mu-2) / 6
+        h[1] =  (mu+1) (mu-1) (mu-2) / 2
+        h[2] = -(mu+1) mu (mu-2) / 2
+        h[3] =  (mu+1) mu (mu-1) / 6
+
+    When mu is 0, h[1] is exactly 1.0 and the others are 0.
+*/
+static void delay_lagrange_weights(
+    int32_t h_q30[4],
+    const unsigned frac_q16)
+{
+    const int64_t mu = ((int64_t) frac_q16) << (30 - DELAY_FRAC_BITS);
+    const int64_t mu_p1 = mu + Q30_ONE;
+    const int64_t mu_m1 = mu - Q30_ONE;
+    const int64_t mu_m2 = mu - 2*Q30_ONE;
+
+    const int64_t p1m1 = MUL_Q30(mu_p1, mu_m1);
+
+    h_q30[0] = (int32_t) (-MUL_Q30(MUL_Q30(mu, mu_m1), mu_m2) / 6);
+    h_q30[1] = (int32_t) ( MUL_Q30(p1m1, mu_m2) / 2);
+    h_q30[2] = (int32_t) (-MUL_Q30(MUL_Q30(mu_p1, mu), mu_m2) / 2);
+    h_q30[3] = (int32_t) ( MUL_Q30(p1m1, mu) / 6);
+}
+
+
+void xs3_delay_s32_read(
+    const xs3_delay_s32_t* delay,
+    int32_t output[],
+    const unsigned count,
+    const fixed_s32_t delay_q16)
+{
+    assert(delay_q16 >= (1 << DELAY_FRAC_BITS));
+
+    const unsigned len = delay->length;
+    const unsigned whole = ((unsigned) delay_q16) >> DELAY_FRAC_BITS;
+    const unsigned frac = ((unsigned) delay_q16) & ((1 << DELAY_FRAC_BITS) - 1);
+
+    assert(whole + count + 2 <= len);
+
+    int32_t h[4];
+    delay_lagrange_weights(h, frac);
+
+    // Buffer index of x[P-2] for the first output sample. The most recent sample is at head-1.
+    unsigned k0 = delay->head + len - (count + whole + 2);
+    if(k0 >= len) k0 -= len;
+    unsigned k1 = (k0 + 1 == len)? 0 : k0 + 1;
+    unsigned k2 = (k1 + 1 == len)? 0 : k1 + 1;
+    unsigned k3 = (k2 + 1 == len)? 0 : k2 + 1;
+
+    const int32_t* x = delay->buffer;
+
+    for(int k = 0; k < count; k++){
+        vpu_int32_acc_t acc = 0;
+        acc = vlmacc32(acc, x[k3], h[0]);
+        acc = vlmacc32(acc, x[k2], h[1]);
+        acc = vlmacc32(acc, x[k1], h[2]);
+        acc = vlmacc32(acc, x[k0], h[3]);
+        output[k] = vlsat32(acc, 0);
+
+        k0 = k1;
+        k1 = k2;
+        k2 = k3;
+        k3 = (k3 + 1 == len)? 0 : k3 + 1;
+    }
+}
+
+
+void xs3_delay_s32_read_taps(
+    const xs3_delay_s32_t* delay,
+    int32_t output[],
+    const unsigned count,
+    const fixed_s32_t delay_q16[],
+    const unsigned tap_count)
+{
+    for(int i = 0; i < tap_count; i++)
+        xs3_delay_s32_read(delay, &output[i * count], count, delay_q16[i]);
+}
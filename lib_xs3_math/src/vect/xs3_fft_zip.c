@@ -0,0 +1,79 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+/*
+ * If the two real channels are adjacent in memory, then together they are a 2N-word vector whose
+ * word index is (channel << log2(N)) | n. Interleaving them and bit-reversing the complex index
+ * takes that word to index (bitrev(n) << 1) | channel, which is just the (log2(N)+1)-bit reversal
+ * of the original word index. Bit-reversal is its own inverse, so it can be done in-place by
+ * swapping pairs of words, with no scratch buffer. This works in both directions.
+ */
+static void bit_reversal_s32_in_place(
+    int32_t x[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    const unsigned bits = ceil_log2(length) + 1;
+
+    for(int s = 0; s < 2 * length; s++){
+        const unsigned d = n_bitrev(s, bits);
+
+        if(d < s) continue;
+
+        const int32_t tmp = x[s];
+        x[s] = vlashr32(x[d], (d < length)? b_shr : c_shr);
+        x[d] = vlashr32(tmp,  (s < length)? b_shr : c_shr);
+    }
+}
+
+
+void xs3_fft_zip_bit_reversal(
+    complex_s32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    if(((int32_t*) a == b) && (c == &b[length])){
+        bit_reversal_s32_in_place((int32_t*) a, length, b_shr, c_shr);
+        return;
+    }
+
+    const unsigned bits = ceil_log2(length);
+
+    for(int n = 0; n < length; n++){
+        const unsigned r = n_bitrev(n, bits);
+        a[r].re = vlashr32(b[n], b_shr);
+        a[r].im = vlashr32(c[n], c_shr);
+    }
+}
+
+
+void xs3_fft_unzip_bit_reversal(
+    int32_t a[],
+    int32_t b[],
+    const complex_s32_t c[],
+    const unsigned length)
+{
+    if((a == (int32_t*) c) && (b == &a[length])){
+        bit_reversal_s32_in_place(a, length, 0, 0);
+        return;
+    }
+
+    const unsigned bits = ceil_log2(length);
+
+    for(int n = 0; n < length; n++){
+        const unsigned r = n_bitrev(n, bits);
+        a[n] = c[r].re;
+        b[n] = c[r].im;
+    }
+}
@@ -0,0 +1,169 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+#define Q30_ONE         (((int64_t)1) << 30)
+#define SQRT2_Q30       (1518500250)
+
+#define MUL_Q30(X, Y)       ((((int64_t)(X)) * (Y) + (1<<29)) >> 30)
+
+
+// Biquad coefficients (b0, b1, b2, -a1, -a2) of the sections used at one crossover frequency
+typedef struct {
+    int32_t lp[5];
+    int32_t hp[5];
+    int32_t ap[5];
+} xover_coefs_t;
+
+
+/*
+ * Butterworth (Q = 1/sqrt(2)) lowpass and highpass sections at prewarped gain K, and the 2nd order allpass 
+ * which an LR4 lowpass/highpass pair sums to. All three share the denominator 1 + a1 z^-1 + a2 z^-2.
+ */
+static void xover_design(
+    xover_coefs_t* c,
+    const int32_t K_q30)
+{
+    const int64_t K2 = MUL_Q30(K_q30, K_q30);
+    const int64_t rK = MUL_Q30(SQRT2_Q30, K_q30);
+    const int64_t den = Q30_ONE + rK + K2;
+    const int64_t norm = ((Q30_ONE << 30) + (den >> 1)) / den;
+
+    const int32_t a1 = (int32_t) MUL_Q30(2 * (K2 - Q30_ONE), norm);
+    const int32_t a2 = (int32_t) MUL_Q30(Q30_ONE - rK + K2, norm);
+    const int32_t lp_b0 = (int32_t) MUL_Q30(K2, norm);
+
+    const int32_t lp[5] = { lp_b0, 2*lp_b0, lp_b0, -a1, -a2 };
+    const int32_t hp[5] = { (int32_t) norm, (int32_t) (-2*norm), (int32_t) norm, -a1, -a2 };
+    const int32_t ap[5] = { a2, a1, (int32_t) Q30_ONE, -a1, -a2 };
+
+    memcpy(c->lp, lp, sizeof(lp));
+    memcpy(c->hp, hp, sizeof(hp));
+    memcpy(c->ap, ap, sizeof(ap));
+}
+
+
+// Appends a lane fed by `source`, returning the source index of its output
+static unsigned xover_add_lane(
+    xs3_filter_crossover_s32_t* xover,
+    const unsigned source,
+    const int32_t coef[5])
+{
+    const unsigned lane = xover->section_count++;
+    assert(lane < XS3_FILTER_CROSSOVER_LANES);
+
+    xover->source[lane] = source;
+    for(int j = 0; j < 5; j++)
+        xover->coef[j][lane] = coef[j];
+
+    return lane + 1;
+}
+
+
+/*
+ * Split the signal from `source` into the bands between crossover frequencies lo and hi (exclusive), the lowest 
+ * of which is band `band`. The split is made at the middle frequency, and each branch is passed through the 
+ * allpass of every frequency handled by the other branch.
+ */
+static void xover_split(
+    xs3_filter_crossover_s32_t* xover,
+    const xover_coefs_t coefs[],
+    const unsigned source,
+    const unsigned lo,
+    const unsigned hi,
+    const unsigned band)
+{
+    if(lo == hi){
+        xover->band_lane[band] = source - 1;
+        return;
+    }
+
+    const unsigned m = (lo + hi) / 2;
+
+    unsigned low = xover_add_lane(xover, source, coefs[m].lp);
+    low = xover_add_lane(xover, low, coefs[m].lp);
+
+    unsigned high = xover_add_lane(xover, source, coefs[m].hp);
+    high = xover_add_lane(xover, high, coefs[m].hp);
+
+    for(int j = m+1; j < hi; j++)
+        low = xover_add_lane(xover, low, coefs[j].ap);
+
+    for(int j = lo; j < m; j++)
+        high = xover_add_lane(xover, high, coefs[j].ap);
+
+    xover_split(xover, coefs, low, lo, m, band);
+    xover_split(xover, coefs, high, m+1, hi, band + (m - lo) + 1);
+}
+
+
+void xs3_filter_crossover_s32_init(
+    xs3_filter_crossover_s32_t* xover,
+    const unsigned band_count,
+    const fixed_s32_t K_q30[])
+{
+    assert(band_count >= 2 && band_count <= XS3_FILTER_CROSSOVER_MAX_BANDS);
+
+    xover_coefs_t coefs[XS3_FILTER_CROSSOVER_MAX_BANDS - 1];
+
+    for(int j = 0; j < band_count - 1; j++){
+        assert(K_q30[j] > 0 && K_q30[j] < Q30_ONE);
+        xover_design(&coefs[j], K_q30[j]);
+    }
+
+    memset(xover, 0, sizeof(xs3_filter_crossover_s32_t));
+    xover->band_count = band_count;
+
+    xover_split(xover, coefs, 0, 0, band_count - 1, 0);
+}
+
+
+void xs3_filter_crossover_s32(
+    xs3_filter_crossover_s32_t* xover,
+    int32_t bands[],
+    const int32_t input[],
+    const unsigned length)
+{
+    const unsigned lanes = xover->section_count;
+    int32_t (*s)[XS3_FILTER_CROSSOVER_LANES] = xover->state;
+    int32_t (*c)[XS3_FILTER_CROSSOVER_LANES] = xover->coef;
+
+    vpu_int32_acc_t acc[XS3_FILTER_CROSSOVER_LANES];
+    int32_t out[XS3_FILTER_CROSSOVER_LANES];
+
+    for(int n = 0; n < length; n++){
+
+        // Terms depending only on filter history. These don't depend on any lane's output, so they can
+        // be found for every lane before any b0 term.
+        for(int i = 0; i < lanes; i++){
+            acc[i] = 0;
+            acc[i] = vlmacc32(acc[i], s[0][i], c[1][i]);
+            acc[i] = vlmacc32(acc[i], s[1][i], c[2][i]);
+            acc[i] = vlmacc32(acc[i], s[2][i], c[3][i]);
+            acc[i] = vlmacc32(acc[i], s[3][i], c[4][i]);
+        }
+
+        // b0 terms, in lane order so that each lane's input is available
+        for(int i = 0; i < lanes; i++){
+            const int32_t x = (xover->source[i] == 0)? input[n] : out[xover->source[i] - 1];
+
+            out[i] = vlsat32(vlmacc32(acc[i], x, c[0][i]), 0);
+
+            s[1][i] = s[0][i];
+            s[0][i] = x;
+            s[3][i] = s[2][i];
+            s[2][i] = out[i];
+        }
+
+        for(int b = 0; b < xover->band_count; b++)
+            bands[b * length + n] = out[xover->band_lane[b]];
+    }
+}
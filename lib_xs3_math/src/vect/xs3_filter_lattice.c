@@ -0,0 +1,64 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+void xs3_filter_lattice_s32_init(
+    xs3_filter_lattice_s32_t* filter,
+    int32_t state_buffer[],
+    const unsigned order,
+    const int32_t refl_coef[],
+    const int32_t ladder_coef[])
+{
+    assert(order != 0);
+    filter->order = order;
+    filter->refl_coef = refl_coef;
+    filter->ladder_coef = ladder_coef;
+    filter->state = state_buffer;
+    memset(state_buffer, 0, order * sizeof(int32_t));
+}
+
+
+void xs3_filter_lattice_s32(
+    xs3_filter_lattice_s32_t* filter,
+    int32_t output[],
+    const int32_t input[],
+    const unsigned length)
+{
+    const unsigned M = filter->order;
+    const int32_t* k = filter->refl_coef;
+    const int32_t* v = filter->ladder_coef;
+    int32_t* g = filter->state;
+
+    for(int n = 0; n < length; n++){
+        int32_t f = input[n];
+        vpu_int32_acc_t y = 0;
+
+        // g[m] holds g_m[n-1] until stage m+1 has consumed it, and g_m[n] thereafter.
+        for(int m = M; m > 0; m--){
+            f = vlsat32(vlmacc32(f, g[m-1], -k[m-1]), 0);
+            const int32_t g_m = vlsat32(vlmacc32(g[m-1], f, k[m-1]), 0);
+
+            if(v != NULL) 
+                y = vlmacc32(y, g_m, v[m]);
+            if(m < M) 
+                g[m] = g_m;
+        }
+
+        g[0] = f;
+
+        if(v != NULL){
+            y = vlmacc32(y, f, v[0]);
+            output[n] = vlsat32(y, 0);
+        } else {
+            output[n] = f;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+#define Q30_ONE     (((int64_t)1) << 30)
+
+#define MUL_Q30(X, Y)       ((((int64_t)(X)) * (Y) + (1<<29)) >> 30)
+
+
+void xs3_filter_svf_bank_s32_init(
+    xs3_filter_svf_bank_s32_t* bank,
+    const unsigned filter_count,
+    const fixed_s32_t g_q30[],
+    const fixed_s32_t k_q30[])
+{
+    assert(filter_count != 0 && filter_count <= 8);
+
+    memset(bank, 0, sizeof(xs3_filter_svf_bank_s32_t));
+    bank->filter_count = filter_count;
+
+    for(int i = 0; i < filter_count; i++){
+        assert(g_q30[i] >= 0 && k_q30[i] >= 0);
+
+        // a1 = 1 / (1 + g*(g+k))
+        const int64_t den = Q30_ONE + MUL_Q30(g_q30[i], ((int64_t) g_q30[i]) + k_q30[i]);
+        const int64_t a1 = ((Q30_ONE << 30) + (den >> 1)) / den;
+        const int64_t a2 = MUL_Q30(g_q30[i], a1);
+        const int64_t a3 = MUL_Q30(g_q30[i], a2);
+
+        bank->coef[0][i] = (int32_t) a1;
+        bank->coef[1][i] = (int32_t) a2;
+        bank->coef[2][i] = (int32_t) a3;
+        bank->coef[3][i] = k_q30[i];
+    }
+}
+
+
+void xs3_filter_svf_bank_s32(
+    xs3_filter_svf_bank_s32_t* bank,
+    int32_t lowpass[],
+    int32_t bandpass[],
+    int32_t highpass[],
+    const int32_t input[],
+    const unsigned length)
+{
+    int32_t (*s)[8] = bank->state;
+    int32_t (*c)[8] = bank->coef;
+
+    for(int n = 0; n < length; n++){
+        const int32_t x = input[n];
+
+        for(int i = 0; i < bank->filter_count; i++){
+            const int32_t v3 = SAT(32)(((int64_t) x) - s[1][i]);
+
+            vpu_int32_acc_t acc = 0;
+            acc = vlmacc32(acc, s[0][i], c[0][i]);
+            acc = vlmacc32(acc, v3, c[1][i]);
+            const int32_t v1 = vlsat32(acc, 0);
+
+            acc = s[1][i];
+            acc = vlmacc32(acc, s[0][i], c[1][i]);
+            acc = vlmacc32(acc, v3, c[2][i]);
+            const int32_t v2 = vlsat32(acc, 0);
+
+            s[0][i] = SAT(32)(2 * ((int64_t) v1) - s[0][i]);
+            s[1][i] = SAT(32)(2 * ((int64_t) v2) - s[1][i]);
+
+            if(lowpass != NULL)
+                lowpass[i * length + n] = v2;
+            if(bandpass != NULL)
+                bandpass[i * length + n] = v1;
+            if(highpass != NULL){
+                acc = ((int64_t) x) - v2;
+                acc = vlmacc32(acc, v1, -c[3][i]);
+                highpass[i * length + n] = vlsat32(acc, 0);
+            }
+        }
+    }
+}
@@ -431,6 +431,54 @@ void xs3_vect_s32_add_prepare(
 }
 
 
+/* ******************
+ *
+ *
+ * ******************/
+void xs3_vect_s32_max_elementwise_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    right_shift_t* c_shr,
+    const exponent_t b_exp,
+    const exponent_t c_exp,
+    const headroom_t b_hr,
+    const headroom_t c_hr)
+{
+    // Each output element is one of the input elements, so (unlike addition) no growth needs to be
+    // accounted for.
+    const exponent_t b_min_exp = b_exp - b_hr;
+    const exponent_t c_min_exp = c_exp - c_hr;
+
+    *a_exp = MAX(b_min_exp, c_min_exp);
+
+    *b_shr = *a_exp - b_exp;
+    *c_shr = *a_exp - c_exp;
+}
+
+
+/* ******************
+ *
+ *
+ * ******************/
+void xs3_vect_s32_moments_prepare(
+    exponent_t* a_exp,
+    right_shift_t* b_shr,
+    const unsigned length,
+    const exponent_t b_exp,
+    const headroom_t b_hr)
+{
+    /*
+        The difference between an element and the pivot (another element) needs up to 33-b_hr bits.
+        To keep the sum of  length  squared differences within 63 bits, each shifted difference must
+        have at most 31 - ceil(ceil_log2(length)/2) bits (including the sign bit).
+    */
+    const unsigned guard_bits = (ceil_log2(length) + 1) / 2;
+
+    *b_shr = 1 - ((int)b_hr) + guard_bits;
+    *a_exp = b_exp + *b_shr;
+}
+
+
     
 /* ******************
  *
@@ -703,4 +751,20 @@ void xs3_vect_s32_clip_prepare(
 
     *upper_bound = ub;
     *lower_bound = lb;
-}
\ No newline at end of file
+}
+
+/* ******************
+ *
+ *
+ * ******************/
+void xs3_vect_s32_cumsum_prepare(
+    exponent_t* a_exp,
+    right_shift_t* a_shr,
+    const unsigned length,
+    const exponent_t b_exp,
+    const headroom_t b_hr)
+{
+    // No partial sum can exceed  length  times the largest element magnitude.
+    *a_shr = ((int) ceil_log2(length)) - b_hr;
+    *a_exp = b_exp + *a_shr;
+}
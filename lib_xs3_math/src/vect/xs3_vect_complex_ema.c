@@ -0,0 +1,52 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+headroom_t xs3_vect_complex_s32_conj_macc_ema(
+    complex_s32_t acc[],
+    const complex_s32_t b[],
+    const complex_s32_t c[],
+    const unsigned length,
+    const fixed_s32_t alpha_q30,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    // The conjugate product is formed exactly as in xs3_vect_complex_s32_conj_macc(). Both terms of
+    // the weighted sum are then accumulated at 64 bits so that only one rounding happens per part.
+    const int64_t alpha = alpha_q30;
+    const int64_t beta = 0x40000000 - alpha_q30;
+
+    for(int k = 0; k < length; k++){
+        const int64_t B_re = ASHR(32)(b[k].re, b_shr);
+        const int64_t B_im = ASHR(32)(b[k].im, b_shr);
+        const int64_t C_re = ASHR(32)(c[k].re, c_shr);
+        const int64_t C_im = ASHR(32)(c[k].im, c_shr);
+
+        const int64_t q1 = ROUND_SHR( B_re * C_re, 30 );
+        const int64_t q2 = ROUND_SHR( B_im * C_im, 30 );
+        const int64_t q3 = ROUND_SHR( B_re * C_im, 30 );
+        const int64_t q4 = ROUND_SHR( B_im * C_re, 30 );
+
+        const int64_t P_re = SAT(32)(q1 + q2);
+        const int64_t P_im = SAT(32)(q4 - q3);
+
+        const int64_t A_re = vlashr32(acc[k].re, acc_shr);
+        const int64_t A_im = vlashr32(acc[k].im, acc_shr);
+
+        const int64_t s_re = ROUND_SHR( alpha * A_re + beta * P_re, 30 );
+        const int64_t s_im = ROUND_SHR( alpha * A_im + beta * P_im, 30 );
+
+        acc[k].re = SAT(32)(s_re);
+        acc[k].im = SAT(32)(s_im);
+    }
+
+    return xs3_vect_complex_s32_headroom(acc, length);
+}
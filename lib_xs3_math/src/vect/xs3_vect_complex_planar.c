@@ -0,0 +1,160 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+/*
+ * The arithmetic in each of these matches the corresponding interleaved (complex_s32_t) function
+ * exactly, so that results do not depend on which layout is used. Only the addressing differs.
+ */
+
+
+headroom_t xs3_vect_complex_s32_planar_headroom(
+    const int32_t x_real[],
+    const int32_t x_imag[],
+    const unsigned length)
+{
+    const headroom_t re_hr = xs3_vect_s32_headroom(x_real, length);
+    const headroom_t im_hr = xs3_vect_s32_headroom(x_imag, length);
+    return MIN(re_hr, im_hr);
+}
+
+
+headroom_t xs3_vect_complex_s32_planar_mul(
+    int32_t a_real[],
+    int32_t a_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int64_t B_re = ASHR(32)(b_real[k], b_shr);
+        const int64_t B_im = ASHR(32)(b_imag[k], b_shr);
+        const int64_t C_re = ASHR(32)(c_real[k], c_shr);
+        const int64_t C_im = ASHR(32)(c_imag[k], c_shr);
+
+        const int64_t q1 = ROUND_SHR( B_re * C_re, 30 );
+        const int64_t q2 = ROUND_SHR( B_im * C_im, 30 );
+        const int64_t q3 = ROUND_SHR( B_re * C_im, 30 );
+        const int64_t q4 = ROUND_SHR( B_im * C_re, 30 );
+
+        a_real[k] = SAT(32)(q1 - q2);
+        a_imag[k] = SAT(32)(q3 + q4);
+    }
+
+    return xs3_vect_complex_s32_planar_headroom(a_real, a_imag, length);
+}
+
+
+headroom_t xs3_vect_complex_s32_planar_conj_mul(
+    int32_t a_real[],
+    int32_t a_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int64_t B_re = ASHR(32)(b_real[k], b_shr);
+        const int64_t B_im = ASHR(32)(b_imag[k], b_shr);
+        const int64_t C_re = ASHR(32)(c_real[k], c_shr);
+        const int64_t C_im = ASHR(32)(c_imag[k], c_shr);
+
+        const int64_t q1 = ROUND_SHR( B_re * C_re, 30 );
+        const int64_t q2 = ROUND_SHR( B_im * C_im, 30 );
+        const int64_t q3 = ROUND_SHR( B_re * C_im, 30 );
+        const int64_t q4 = ROUND_SHR( B_im * C_re, 30 );
+
+        a_real[k] = SAT(32)(q1 + q2);
+        a_imag[k] = SAT(32)(q4 - q3);
+    }
+
+    return xs3_vect_complex_s32_planar_headroom(a_real, a_imag, length);
+}
+
+
+headroom_t xs3_vect_complex_s32_planar_macc(
+    int32_t acc_real[],
+    int32_t acc_imag[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const int32_t c_real[],
+    const int32_t c_imag[],
+    const unsigned length,
+    const right_shift_t acc_shr,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    for(int k = 0; k < length; k++){
+        const int64_t B_re = ASHR(32)(b_real[k], b_shr);
+        const int64_t B_im = ASHR(32)(b_imag[k], b_shr);
+        const int64_t C_re = ASHR(32)(c_real[k], c_shr);
+        const int64_t C_im = ASHR(32)(c_imag[k], c_shr);
+
+        const int64_t q1 = ROUND_SHR( B_re * C_re, 30 );
+        const int64_t q2 = ROUND_SHR( B_im * C_im, 30 );
+        const int64_t q3 = ROUND_SHR( B_re * C_im, 30 );
+        const int64_t q4 = ROUND_SHR( B_im * C_re, 30 );
+
+        acc_real[k] = vladd32( vlashr32( acc_real[k], acc_shr ), SAT(32)(q1 - q2) );
+        acc_imag[k] = vladd32( vlashr32( acc_imag[k], acc_shr ), SAT(32)(q3 + q4) );
+    }
+
+    return xs3_vect_complex_s32_planar_headroom(acc_real, acc_imag, length);
+}
+
+
+headroom_t xs3_vect_complex_s32_planar_mag(
+    int32_t a[],
+    const int32_t b_real[],
+    const int32_t b_imag[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const complex_s32_t* rot_table,
+    const unsigned table_rows)
+{
+    for(int k = 0; k < length; k++){
+        
+        complex_s32_t B = {
+            vlashr32(b_real[k], b_shr), 
+            vlashr32(b_imag[k], b_shr),
+        };
+
+        // Reflect B into the first quadrant, then repeatedly rotate it towards the real axis.
+        B.re = vlmul32(vsign32(B.re), B.re);
+        B.im = vlmul32(vsign32(B.im), B.im);
+
+        for(int iter = 0; iter < table_rows; iter++){
+
+            const complex_s32_t rot = {
+                rot_table[iter * 4].re,
+                rot_table[iter * 4].im
+            };
+
+            const complex_s32_t new_B = {
+                vcmr32(B, rot),
+                vcmi32(B, rot),
+            };
+
+            B.re = vlmul32(vsign32(new_B.re), new_B.re);
+            B.im = vlmul32(vsign32(new_B.im), new_B.im);
+        }
+
+        a[k] = B.re;
+    }
+
+    return xs3_vect_s32_headroom(a, length);
+}
@@ -0,0 +1,97 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+headroom_t xs3_vect_s32_max_elementwise(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int32_t mag = 0;
+
+    for(int k = 0; k < length; k++){
+        const int32_t B = vlashr32(b[k], b_shr);
+        const int32_t C = vlashr32(c[k], c_shr);
+        a[k] = MAX(B, C);
+        mag |= (a[k] < 0)? ~a[k] : a[k];
+    }
+
+    return HR_S32(mag);
+}
+
+
+headroom_t xs3_vect_s32_min_elementwise(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int32_t mag = 0;
+
+    for(int k = 0; k < length; k++){
+        const int32_t B = vlashr32(b[k], b_shr);
+        const int32_t C = vlashr32(c[k], c_shr);
+        a[k] = MIN(B, C);
+        mag |= (a[k] < 0)? ~a[k] : a[k];
+    }
+
+    return HR_S32(mag);
+}
+
+
+headroom_t xs3_vect_s32_select(
+    int32_t a[],
+    const int32_t b[],
+    const int32_t c[],
+    const int8_t mask[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const right_shift_t c_shr)
+{
+    int32_t mag = 0;
+
+    for(int k = 0; k < length; k++){
+        a[k] = mask[k]? vlashr32(b[k], b_shr) : vlashr32(c[k], c_shr);
+        mag |= (a[k] < 0)? ~a[k] : a[k];
+    }
+
+    return HR_S32(mag);
+}
+
+
+headroom_t xs3_vect_s32_affine(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const int32_t scale,
+    const int64_t offset,
+    const right_shift_t a_shr)
+{
+    int32_t mag = 0;
+
+    for(int k = 0; k < length; k++){
+        int64_t p = ((int64_t)b[k]) * scale + offset;
+
+        if(a_shr >= 64)         p = 0;
+        else if(a_shr > 0)      p = ((p >> (a_shr-1)) + 1) >> 1;
+        else if(a_shr < 0)      p = (p > (INT64_MAX >> -a_shr))? INT64_MAX 
+                                  : (p < (INT64_MIN >> -a_shr))? INT64_MIN 
+                                  : p << -a_shr;
+
+        a[k] = (p >= VPU_INT32_MAX)? VPU_INT32_MAX : (p <= VPU_INT32_MIN)? VPU_INT32_MIN : (int32_t) p;
+        mag |= (a[k] < 0)? ~a[k] : a[k];
+    }
+
+    return HR_S32(mag);
+}
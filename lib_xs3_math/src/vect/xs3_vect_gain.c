@@ -0,0 +1,146 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+
+
+/*
+ * Shift a (non-negative) power mantissa by `shr` bits. Negative powers are treated as 0.
+ */
+static inline int64_t pow_shr(
+    const int32_t x,
+    const right_shift_t shr)
+{
+    if(x <= 0 || shr >= 32) return 0;
+    return (shr >= 0)? (((int64_t)x) >> shr) : (((int64_t)x) << -shr);
+}
+
+
+/*
+ * Compute the Q2.30 gain  num / (num + den), clamped below at gain_min.
+ *
+ * num and den are both non-negative and less than 2^32.
+ */
+static inline int32_t wiener_ratio_q30(
+    const int64_t num,
+    const int64_t den,
+    const int32_t gain_min)
+{
+    const int64_t total = num + den;
+    int32_t gain = (total == 0)? 0x40000000 : (int32_t) ((num << 30) / total);
+    return MAX(gain, gain_min);
+}
+
+
+void xs3_vect_s32_wiener_gain_prepare(
+    right_shift_t* sig_shr,
+    right_shift_t* noise_shr,
+    const exponent_t sig_exp,
+    const exponent_t noise_exp,
+    const headroom_t sig_hr,
+    const headroom_t noise_hr)
+{
+    // Both power vectors are brought to a common exponent, which is the smallest exponent which
+    // does not overflow either of them. The differences are computed with 64-bit intermediates, so
+    // no additional headroom is needed.
+    const exponent_t common_exp = MAX(sig_exp - sig_hr, noise_exp - noise_hr);
+
+    *sig_shr = common_exp - sig_exp;
+    *noise_shr = common_exp - noise_exp;
+}
+
+
+void xs3_vect_s32_wiener_gain_dd_prepare(
+    exponent_t* a_clean_exp,
+    right_shift_t* clean_shr,
+    right_shift_t* sig_shr,
+    right_shift_t* noise_shr,
+    const exponent_t clean_exp,
+    const exponent_t sig_exp,
+    const exponent_t noise_exp,
+    const headroom_t clean_hr,
+    const headroom_t sig_hr,
+    const headroom_t noise_hr)
+{
+    // As with xs3_vect_s32_wiener_gain_prepare(), but the clean power estimate is also brought to
+    // the common exponent, which then becomes the exponent of the updated clean power estimate.
+    // An all-zero clean power estimate (e.g. the first frame) shouldn't influence the exponent.
+    const exponent_t sn_exp = MAX(sig_exp - sig_hr, noise_exp - noise_hr);
+    const exponent_t common_exp = (clean_hr >= 31)? sn_exp : MAX(clean_exp - clean_hr, sn_exp);
+
+    *clean_shr = common_exp - clean_exp;
+    *sig_shr = common_exp - sig_exp;
+    *noise_shr = common_exp - noise_exp;
+    *a_clean_exp = common_exp;
+}
+
+
+headroom_t xs3_vect_s32_wiener_gain(
+    int32_t a[],
+    const int32_t sig_pow[],
+    const int32_t noise_pow[],
+    const unsigned length,
+    const right_shift_t sig_shr,
+    const right_shift_t noise_shr,
+    const int32_t gain_min)
+{
+    for(int k = 0; k < length; k++){
+        const int64_t S = pow_shr(sig_pow[k], sig_shr);
+        const int64_t N = pow_shr(noise_pow[k], noise_shr);
+
+        // Maximum-likelihood a priori SNR is  S/N - 1, for which the Wiener gain simplifies to
+        // (S - N) / S  =  (S - N) / ((S - N) + N)
+        const int64_t num = MAX(S - N, 0);
+
+        a[k] = wiener_ratio_q30(num, N, gain_min);
+    }
+
+    return xs3_vect_s32_headroom(a, length);
+}
+
+
+headroom_t xs3_vect_s32_wiener_gain_dd(
+    int32_t a[],
+    int32_t clean_pow[],
+    headroom_t* clean_hr,
+    const int32_t sig_pow[],
+    const int32_t noise_pow[],
+    const unsigned length,
+    const right_shift_t clean_shr,
+    const right_shift_t sig_shr,
+    const right_shift_t noise_shr,
+    const int32_t alpha,
+    const int32_t gain_min)
+{
+    const int64_t one_minus_alpha = 0x40000000 - (int64_t)alpha;
+
+    int32_t clean_mag = 0;
+
+    for(int k = 0; k < length; k++){
+        const int64_t P = pow_shr(clean_pow[k], clean_shr);
+        const int64_t S = pow_shr(sig_pow[k], sig_shr);
+        const int64_t N = pow_shr(noise_pow[k], noise_shr);
+
+        // Decision-directed a priori SNR (scaled by N, so that no division by N is needed):
+        //   xi * N = alpha * P + (1 - alpha) * max(S - N, 0)
+        // The Wiener gain xi / (1 + xi) is then  (xi * N) / ((xi * N) + N)
+        const int64_t num = ROUND_SHR(alpha * P + one_minus_alpha * MAX(S - N, 0), 30);
+
+        const int32_t gain = wiener_ratio_q30(num, N, gain_min);
+        a[k] = gain;
+
+        // Clean power estimate for the next frame is  gain^2 * S
+        const int64_t gain2 = ROUND_SHR(((int64_t)gain) * gain, 30);
+        clean_pow[k] = (int32_t) ROUND_SHR(gain2 * S, 30);
+
+        clean_mag |= clean_pow[k];
+    }
+
+    *clean_hr = HR_S32(clean_mag);
+
+    return xs3_vect_s32_headroom(a, length);
+}
@@ -0,0 +1,157 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+
+
+/*
+ * Whether element i of b[] ranks below element j. Larger values rank higher, and of equal values
+ * the lower index ranks higher (as with xs3_vect_s32_argmax()).
+ */
+static inline unsigned ranks_below(
+    const int32_t b[],
+    const unsigned i,
+    const unsigned j)
+{
+    return (b[i] < b[j]) || ((b[i] == b[j]) && (i > j));
+}
+
+
+/*
+ * Restore the heap property of heap[] (lowest ranked element at the root) below node n.
+ */
+static void sift_down(
+    unsigned heap[],
+    const int32_t b[],
+    const unsigned size,
+    unsigned n)
+{
+    const unsigned x = heap[n];
+
+    while(1){
+        unsigned child = 2 * n + 1;
+        if(child >= size) 
+            break;
+        if((child + 1 < size) && ranks_below(b, heap[child+1], heap[child]))
+            child++;
+        if(!ranks_below(b, heap[child], x))
+            break;
+        heap[n] = heap[child];
+        n = child;
+    }
+
+    heap[n] = x;
+}
+
+
+void xs3_vect_s32_topk(
+    unsigned indices[],
+    int32_t values[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned K)
+{
+    if(K == 0)
+        return;
+
+    // indices[] is used as a heap of the K highest ranked elements seen so far, with the lowest
+    // ranked of those at the root.
+    for(unsigned k = 0; k < K; k++)
+        indices[k] = k;
+
+    for(int n = (K/2) - 1; n >= 0; n--)
+        sift_down(indices, b, K, n);
+
+    // The root's value is a threshold which the vast majority of remaining elements fail to beat,
+    // so most elements cost only a single comparison. A later element that only equals the
+    // threshold ranks below it.
+    int32_t threshold = b[indices[0]];
+
+    for(unsigned k = K; k < length; k++){
+        if(b[k] <= threshold)
+            continue;
+
+        indices[0] = k;
+        sift_down(indices, b, K, 0);
+        threshold = b[indices[0]];
+    }
+
+    // Heap sort, which leaves indices[] from highest to lowest rank.
+    for(unsigned size = K - 1; size > 0; size--){
+        const unsigned tmp = indices[0];
+        indices[0] = indices[size];
+        indices[size] = tmp;
+        sift_down(indices, b, size, 0);
+    }
+
+    if(values != NULL){
+        for(unsigned k = 0; k < K; k++)
+            values[k] = b[indices[k]];
+    }
+}
+
+
+void xs3_vect_s32_histogram(
+    unsigned counts[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned bins,
+    const int32_t lower,
+    const right_shift_t bin_shr)
+{
+    for(int j = 0; j < bins; j++)
+        counts[j] = 0;
+
+    for(int k = 0; k < length; k++){
+        // 64 bits, because the offset from the lower bound can need 33.
+        const int64_t d = ((int64_t)b[k]) - lower;
+        const int64_t bin = (d < 0)? 0 : (d >> bin_shr);
+        counts[(bin >= bins)? (bins - 1) : bin]++;
+    }
+}
+
+
+int32_t xs3_vect_s32_nth_element(
+    int32_t b[],
+    const unsigned length,
+    const unsigned n)
+{
+    // Quickselect (Hoare partitioning, median-of-3 pivots). Only the part of b[] known to contain
+    // rank n is partitioned each round.
+    unsigned lo = 0;
+    unsigned hi = length - 1;
+
+    while(hi > lo){
+        const unsigned mid = lo + (hi - lo) / 2;
+
+        // Order b[lo] <= b[mid] <= b[hi], which also act as sentinels for the scans below.
+        int32_t tmp;
+        if(b[mid] < b[lo]){ tmp = b[mid]; b[mid] = b[lo]; b[lo] = tmp; }
+        if(b[hi] < b[lo]) { tmp = b[hi];  b[hi] = b[lo];  b[lo] = tmp; }
+        if(b[hi] < b[mid]){ tmp = b[hi];  b[hi] = b[mid]; b[mid] = tmp; }
+
+        if(hi - lo < 3)
+            break;
+
+        const int32_t pivot = b[mid];
+        unsigned i = lo;
+        unsigned j = hi;
+
+        while(1){
+            do { i++; } while(b[i] < pivot);
+            do { j--; } while(b[j] > pivot);
+            if(i >= j)
+                break;
+            tmp = b[i]; b[i] = b[j]; b[j] = tmp;
+        }
+
+        // Now b[lo..j] <= pivot <= b[j+1..hi]
+        if(n <= j)  hi = j;
+        else        lo = j + 1;
+    }
+
+    return b[n];
+}
@@ -0,0 +1,61 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+
+
+void xs3_vect_s32_pyramid(
+    int32_t max[],
+    int32_t min[],
+    int32_t mean_sq[],
+    const int32_t b[],
+    const unsigned length,
+    const unsigned levels,
+    const right_shift_t sq_shr)
+{
+    // The first level is computed directly from b[]. Each time an element completes a pair at some
+    // level, that pair is immediately reduced into the next level up (like carries in a binary
+    // counter), so b[] is only read once and the upper levels are built while their inputs are
+    // still fresh, rather than with a separate pass per level.
+
+    for(int k = 0; k < (length >> 1); k++){
+        const int32_t b0 = b[2*k];
+        const int32_t b1 = b[2*k+1];
+
+        max[k] = MAX(b0, b1);
+        min[k] = MIN(b0, b1);
+
+        // Sum of squares can reach 2^63, so it's done unsigned. This is twice the mean square.
+        uint64_t p = ((uint64_t)(((int64_t)b0) * b0)) + ((uint64_t)(((int64_t)b1) * b1));
+        const int s = sq_shr + 1;
+
+        if(s >= 64)         p = 0;
+        else if(s > 0)      p = ((p >> (s-1)) + 1) >> 1;
+        else if(s <= -64)   p = p? UINT64_MAX : 0;
+        else if(s < 0)      p = (p > (UINT64_MAX >> -s))? UINT64_MAX : (p << -s);
+
+        mean_sq[k] = (p >= VPU_INT32_MAX)? VPU_INT32_MAX : (int32_t) p;
+
+        unsigned base = 0;
+        unsigned count = length >> 1;
+        unsigned i = k;
+
+        for(int lvl = 1; (lvl < levels) && (i & 1); lvl++){
+            const unsigned up = base + count;
+            const unsigned a0 = base + i - 1;
+            const unsigned a1 = base + i;
+            const unsigned dex = up + (i >> 1);
+
+            max[dex] = MAX(max[a0], max[a1]);
+            min[dex] = MIN(min[a0], min[a1]);
+            mean_sq[dex] = (int32_t) ((((int64_t) mean_sq[a0]) + mean_sq[a1] + 1) >> 1);
+
+            base = up;
+            count >>= 1;
+            i >>= 1;
+        }
+    }
+}
@@ -0,0 +1,37 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+
+
+headroom_t xs3_vect_s32_cumsum(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t a_shr)
+{
+    // The running sum is kept exactly in 64 bits (it can't overflow for any length below 2^32),
+    // and only the outputs are shifted, so rounding errors don't accumulate along the vector.
+    int64_t acc = 0;
+    int32_t mag = 0;
+
+    for(int k = 0; k < length; k++){
+        acc += b[k];
+
+        int64_t s = acc;
+
+        if(a_shr >= 64)         s = 0;
+        else if(a_shr > 0)      s = ((s >> (a_shr-1)) + 1) >> 1;
+        else if(a_shr < 0)      s = (s > (INT64_MAX >> -a_shr))? INT64_MAX 
+                                  : (s < (INT64_MIN >> -a_shr))? INT64_MIN 
+                                  : s << -a_shr;
+
+        a[k] = (s >= VPU_INT32_MAX)? VPU_INT32_MAX : (s <= VPU_INT32_MIN)? VPU_INT32_MIN : (int32_t) s;
+        mag |= (a[k] < 0)? ~a[k] : a[k];
+    }
+
+    return HR_S32(mag);
+}
@@ -0,0 +1,75 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+#define Q30_ONE     0x40000000
+
+
+/*
+ * One smoother update, computed as the convex combination (1-c)*y + c*x so that the difference x - y 
+ * never needs to be formed (it could overflow).
+ */
+static inline int32_t smooth_update(
+    const int32_t y,
+    const int32_t x,
+    const int32_t coef_q30)
+{
+    vpu_int32_acc_t acc = 0;
+    acc = vlmacc32(acc, y, Q30_ONE - coef_q30);
+    acc = vlmacc32(acc, x, coef_q30);
+    return vlsat32(acc, 0);
+}
+
+
+headroom_t xs3_vect_s32_smooth(
+    int32_t y[],
+    const int32_t x[],
+    const fixed_s32_t coef_q30,
+    const unsigned length,
+    const right_shift_t y_shr,
+    const right_shift_t x_shr)
+{
+    for(int k = 0; k < length; k++)
+        y[k] = smooth_update(ASHR(32)(y[k], y_shr), ASHR(32)(x[k], x_shr), coef_q30);
+
+    return xs3_vect_s32_headroom(y, length);
+}
+
+
+headroom_t xs3_vect_s32_smooth_vect(
+    int32_t y[],
+    const int32_t x[],
+    const fixed_s32_t coef_q30[],
+    const unsigned length,
+    const right_shift_t y_shr,
+    const right_shift_t x_shr)
+{
+    for(int k = 0; k < length; k++)
+        y[k] = smooth_update(ASHR(32)(y[k], y_shr), ASHR(32)(x[k], x_shr), coef_q30[k]);
+
+    return xs3_vect_s32_headroom(y, length);
+}
+
+
+void xs3_vect_s32_smooth_prepare(
+    exponent_t* new_y_exp,
+    right_shift_t* y_shr,
+    right_shift_t* x_shr,
+    const exponent_t y_exp,
+    const exponent_t x_exp,
+    const headroom_t y_hr,
+    const headroom_t x_hr)
+{
+    const exponent_t exp = MAX(y_exp - (int) y_hr, x_exp - (int) x_hr);
+
+    *y_shr = MIN(exp - y_exp, 31);
+    *x_shr = MIN(exp - x_exp, 31);
+    *new_y_exp = exp;
+}
@@ -0,0 +1,98 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+#define Q30_ONE             (0x40000000)
+
+// The tanh table has 2^TANH_LUT_BITS segments covering [0, 2) in Q2.30
+#define TANH_LUT_BITS       (8)
+#define TANH_SEG_SHR        (31 - TANH_LUT_BITS)
+
+// tanh(k / 128) in Q2.30, for k = 0, 1, ..., 256
+static const int32_t tanh_lut[(1 << TANH_LUT_BITS) + 1] = {
+    0, 8388437, 16775851, 25161217, 33543514, 41921720, 50294816, 58661787,
+    67021619, 75373302, 83715829, 92048200, 100369417, 108678490, 116974433, 125256267,
+    133523019, 141773725, 150007427, 158223175, 166420030, 174597058, 182753337, 190887955,
+    199000008, 207088605, 215152863, 223191913, 231204897, 239190966, 247149288, 255079039,
+    262979411, 270849608, 278688847, 286496360, 294271390, 302013199, 309721058, 317394256,
+    325032097, 332633898, 340198992, 347726728, 355216470, 362667598, 370079506, 377451607,
+    384783327, 392074109, 399323414, 406530717, 413695509, 420817299, 427895611, 434929986,
+    441919982, 448865172, 455765145, 462619508, 469427884, 476189910, 482905241, 489573549,
+    496194519, 502767856, 509293276, 515770515, 522199322, 528579463, 534910717, 541192881,
+    547425766, 553609197, 559743014, 565827074, 571861244, 577845409, 583779466, 589663328,
+    595496917, 601280175, 607013051, 612695512, 618327534, 623909109, 629440237, 634920935,
+    640351229, 645731158, 651060770, 656340128, 661569304, 666748379, 671877449, 676956616,
+    681985995, 686965708, 691895889, 696776681, 701608235, 706390712, 711124280, 715809118,
+    720445410, 725033350, 729573140, 734064988, 738509109, 742905727, 747255071, 751557377,
+    755812887, 760021850, 764184519, 768301155, 772372023, 776397393, 780377540, 784312745,
+    788203292, 792049471, 795851574, 799609898, 803324746, 806996420, 810625229, 814211483,
+    817755498, 821257590, 824718078, 828137284, 831515533, 834853152, 838150469, 841407813,
+    844625518, 847803917, 850943344, 854044137, 857106631, 860131166, 863118081, 866067714,
+    868980407, 871856501, 874696335, 877500252, 880268593, 883001698, 885699910, 888363570,
+    890993016, 893588591, 896150633, 898679481, 901175474, 903638948, 906070241, 908469688,
+    910837623, 913174379, 915480290, 917755685, 920000894, 922216245, 924402065, 926558678,
+    928686409, 930785579, 932856508, 934899515, 936914916, 938903025, 940864156, 942798620,
+    944706725, 946588779, 948445085, 950275948, 952081667, 953862541, 955618867, 957350938,
+    959059047, 960743482, 962404532, 964042482, 965657614, 967250208, 968820543, 970368895,
+    971895537, 973400739, 974884771, 976347899, 977790386, 979212493, 980614480, 981996603,
+    983359117, 984702271, 986026317, 987331500, 988618065, 989886254, 991136306, 992368457,
+    993582944, 994779997, 995959846, 997122719, 998268841, 999398434, 1000511717, 1001608910,
+    1002690226, 1003755880, 1004806081, 1005841038, 1006860957, 1007866041, 1008856492, 1009832509,
+    1010794288, 1011742023, 1012675908, 1013596131, 1014502881, 1015396344, 1016276701, 1017144135,
+    1017998824, 1018840945, 1019670673, 1020488180, 1021293637, 1022087212, 1022869072, 1023639379,
+    1024398298, 1025145987, 1025882605, 1026608308, 1027323250, 1028027584, 1028721460, 1029405025,
+    1030078428, 1030741811, 1031395319, 1032039091, 1032673268, 1033297986, 1033913380, 1034519585,
+    1035116732,
+};
+
+
+headroom_t xs3_vect_s32_softclip(
+    int32_t a[],
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr,
+    const softclip_curve_e curve)
+{
+    int32_t mag = 0;
+
+    // The curve is selected once, so each loop body is the same for every element.
+    switch(curve){
+        case SOFTCLIP_TANH:
+            for(int k = 0; k < length; k++){
+                const int32_t u = vlashr32(b[k], b_shr);
+                const int32_t m = (u >= 0)? u : (u == INT32_MIN)? INT32_MAX : -u;
+
+                // Linear interpolation between table entries
+                const unsigned seg = ((uint32_t)m) >> TANH_SEG_SHR;
+                const int32_t frac = m & ((1 << TANH_SEG_SHR) - 1);
+                const int64_t delta = tanh_lut[seg+1] - tanh_lut[seg];
+                const int32_t y = tanh_lut[seg] 
+                    + (int32_t)((delta * frac + (1 << (TANH_SEG_SHR-1))) >> TANH_SEG_SHR);
+
+                a[k] = (u >= 0)? y : -y;
+                mag |= (a[k] < 0)? ~a[k] : a[k];
+            }
+            break;
+
+        case SOFTCLIP_CUBIC:
+        default:
+            for(int k = 0; k < length; k++){
+                int32_t u = vlashr32(b[k], b_shr);
+                u = MIN(MAX(u, -Q30_ONE), Q30_ONE);
+
+                // u + u * (1 - u^2) / 2   ==   (3u - u^3) / 2
+                const int32_t u2 = vlmul32(u, u);
+                a[k] = vladd32(u, vlashr32(vlmul32(u, Q30_ONE - u2), 1));
+                mag |= (a[k] < 0)? ~a[k] : a[k];
+            }
+            break;
+    }
+
+    return HR_S32(mag);
+}
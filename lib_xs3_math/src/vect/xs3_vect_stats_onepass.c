@@ -0,0 +1,241 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+int32_t xs3_vect_s32_abs_max_energy(
+    int64_t* energy,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+    // Same accumulator arrangement as xs3_vect_s32_energy(), so that the energy result matches it.
+    vpu_int32_acc_t acc[VPU_INT32_ACC_PERIOD] = {0};
+
+    int32_t max_abs = 0;
+
+    for(int k = 0; k < length; k++){
+        const int j = k % VPU_INT32_ACC_PERIOD;
+
+        const int32_t mag = (b[k] >= 0)? b[k] : (b[k] == INT32_MIN)? INT32_MAX : -b[k];
+        max_abs = MAX(max_abs, mag);
+
+        const int32_t B = vlashr32(b[k], b_shr);
+        acc[j] = vlmacc32(acc[j], B, B);
+    }
+
+    vpu_int32_acc_t total = 0;
+    for(int j = 0; j < VPU_INT32_ACC_PERIOD; j++)
+        total += acc[j];
+
+    *energy = total;
+
+    return max_abs;
+}
+
+
+void xs3_vect_s32_stats(
+    xs3_vect_s32_stats_t* a,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+    // Energy uses the same accumulator arrangement as xs3_vect_s32_energy(), and the sum the same
+    // (40-bit saturating) accumulation as xs3_vect_s32_sum(), so that both results match them.
+    vpu_int32_acc_t acc[VPU_INT32_ACC_PERIOD] = {0};
+    vpu_int32_acc_t sum = 0;
+
+    unsigned argmax = 0;
+    unsigned argmin = 0;
+
+    for(int k = 0; k < length; k++){
+        const int j = k % VPU_INT32_ACC_PERIOD;
+
+        argmax = (b[k] > b[argmax])? k : argmax;
+        argmin = (b[k] < b[argmin])? k : argmin;
+
+        sum = vlmacc32(sum, b[k], 0x40000000);
+
+        const int32_t B = vlashr32(b[k], b_shr);
+        acc[j] = vlmacc32(acc[j], B, B);
+    }
+
+    vpu_int32_acc_t total = 0;
+    for(int j = 0; j < VPU_INT32_ACC_PERIOD; j++)
+        total += acc[j];
+
+    a->max = b[argmax];
+    a->min = b[argmin];
+    a->argmax = argmax;
+    a->argmin = argmin;
+    a->sum = sum;
+    a->energy = total;
+}
+
+
+void xs3_vect_s32_moments(
+    int64_t* sum,
+    int64_t* sum_sq,
+    const int32_t b[],
+    const unsigned length,
+    const int32_t pivot,
+    const right_shift_t b_shr)
+{
+    // Elements are taken relative to the pivot so that the variance can be found from these sums
+    // without catastrophic cancellation when the mean is large compared to the spread. b_shr is
+    // chosen (by xs3_vect_s32_moments_prepare()) so that neither sum can overflow, so both are
+    // exact. Rounding (rather than truncating) when shifting right keeps the mean unbiased.
+    int64_t s1 = 0;
+    int64_t s2 = 0;
+
+    for(int k = 0; k < length; k++){
+        int64_t d = ((int64_t)b[k]) - pivot;
+        d = (b_shr > 0)? (((d >> (b_shr-1)) + 1) >> 1) : (d << -b_shr);
+
+        s1 += d;
+        s2 += d * d;
+    }
+
+    *sum = s1;
+    *sum_sq = s2;
+}
+
+
+int64_t xs3_vect_s32_energy_zcr(
+    unsigned* zero_crossings,
+    const int32_t b[],
+    const unsigned length,
+    const right_shift_t b_shr)
+{
+    // Same accumulator arrangement as xs3_vect_s32_energy(), so that the energy result matches it.
+    // A crossing is any change of sign bit between neighbouring elements (so zero counts as
+    // non-negative, as with xs3_vect_s8_is_negative()), which is just the sign of their XOR.
+    vpu_int32_acc_t acc[VPU_INT32_ACC_PERIOD] = {0};
+
+    unsigned crossings = 0;
+    int32_t prev = b[0];
+
+    for(int k = 0; k < length; k++){
+        const int j = k % VPU_INT32_ACC_PERIOD;
+
+        crossings += ((uint32_t)(b[k] ^ prev)) >> 31;
+        prev = b[k];
+
+        const int32_t B = vlashr32(b[k], b_shr);
+        acc[j] = vlmacc32(acc[j], B, B);
+    }
+
+    vpu_int32_acc_t total = 0;
+    for(int j = 0; j < VPU_INT32_ACC_PERIOD; j++)
+        total += acc[j];
+
+    *zero_crossings = crossings;
+
+    return total;
+}
+
+
+// log2(1 + i/64) as Q8.24, for i in 0..64
+static const int32_t log2_table[65] = {
+    0x00000000, 0x0005B9E6, 0x000B5D6A, 0x0010EB39, 0x001663F7, 0x001BC842,
+    0x002118B1, 0x002655D4, 0x002B8034, 0x00309858, 0x00359EBC, 0x003A93DD,
+    0x003F782D, 0x00444C1F, 0x0049101F, 0x004DC493, 0x005269E1, 0x00570069,
+    0x005B8887, 0x00600296, 0x00646EEA, 0x0068CDD8, 0x006D1FB0, 0x007164BF,
+    0x00759D50, 0x0079C9AB, 0x007DEA16, 0x0081FED4, 0x00860828, 0x008A0650,
+    0x008DF989, 0x0091E20F, 0x0095C01A, 0x009993E3, 0x009D5DA0, 0x00A11D84,
+    0x00A4D3C2, 0x00A8808C, 0x00AC2411, 0x00AFBE80, 0x00B35004, 0x00B6D8CB,
+    0x00BA58FF, 0x00BDD0C8, 0x00C1404F, 0x00C4A7BA, 0x00C80731, 0x00CB5ED7,
+    0x00CEAED0, 0x00D1F740, 0x00D53848, 0x00D87209, 0x00DBA4A4, 0x00DED039,
+    0x00E1F4E5, 0x00E512C7, 0x00E829FB, 0x00EB3A9F, 0x00EE44CD, 0x00F148A1,
+    0x00F44636, 0x00F73DA4, 0x00FA2F04, 0x00FD1A71, 0x01000000,
+};
+
+// 2^(i/64) as unsigned Q2.30, for i in 0..64
+static const uint32_t exp2_table[65] = {
+    0x40000000, 0x40B268FA, 0x4166C34C, 0x421D1462, 0x42D561B4, 0x438FB0CB,
+    0x444C0740, 0x450A6ABB, 0x45CAE0F2, 0x468D6FAE, 0x47521CC6, 0x4818EE22,
+    0x48E1E9BA, 0x49AD1598, 0x4A7A77D4, 0x4B4A169C, 0x4C1BF829, 0x4CF022CA,
+    0x4DC69CDD, 0x4E9F6CD4, 0x4F7A9930, 0x50582888, 0x51382182, 0x521A8AD7,
+    0x52FF6B55, 0x53E6C9DA, 0x54D0AD5A, 0x55BD1CDB, 0x56AC1F75, 0x579DBC57,
+    0x5891FAC1, 0x5988E209, 0x5A82799A, 0x5B7EC8F2, 0x5C7DD7A4, 0x5D7FAD59,
+    0x5E8451D0, 0x5F8BCCDB, 0x60962665, 0x61A3666D, 0x62B39509, 0x63C6BA64,
+    0x64DCDEC3, 0x65F60A7F, 0x6712460B, 0x683199ED, 0x69540EC9, 0x6A79AD56,
+    0x6BA27E65, 0x6CCE8AE1, 0x6DFDDBCC, 0x6F307A41, 0x70666F76, 0x719FC4B9,
+    0x72DC8374, 0x741CB528, 0x75606374, 0x76A7980F, 0x77F25CCE, 0x7940BB9E,
+    0x7A92BE8B, 0x7BE86FBA, 0x7D41D96E, 0x7E9F0606, 0x80000000,
+};
+
+
+/*
+ * log2(x) as Q8.24, for x > 0. The mantissa is normalized into [1, 2) and its log taken by linear
+ * interpolation into log2_table[], which is accurate to within about 2^-14.
+ */
+static int32_t log2_q24(
+    const int32_t x)
+{
+    const headroom_t hr = HR_S32(x);
+    const int32_t frac = (x << hr) - 0x40000000;
+    const int i = frac >> 24;
+    const int32_t rem = frac & 0xFFFFFF;
+
+    const int32_t v = log2_table[i] 
+                    + (int32_t)((((int64_t)(log2_table[i+1] - log2_table[i])) * rem) >> 24);
+
+    return ((30 - hr) << 24) + v;
+}
+
+
+/*
+ * 2^d as Q2.30, for Q8.24 d <= 0.
+ */
+static int32_t exp2_q30(
+    const int32_t d)
+{
+    const int q = (-d + 0xFFFFFF) >> 24;
+    const int32_t r = d + (q << 24);
+
+    if(q >= 32)
+        return 0;
+
+    const int i = r >> 18;
+    const int32_t rem = r & 0x3FFFF;
+
+    const int64_t v = exp2_table[i] 
+                    + ((((int64_t)exp2_table[i+1]) - exp2_table[i]) * rem >> 18);
+
+    return (int32_t)((q == 0)? v : ((v >> (q-1)) + 1) >> 1);
+}
+
+
+fixed_s32_t xs3_vect_s32_spectral_flatness(
+    const int32_t b[],
+    const unsigned length)
+{
+    // The ratio of geometric to arithmetic mean doesn't depend on the exponent, so this works on
+    // the mantissas directly. Both means are taken in the log2 domain:
+    //   log2(GM) = sum(log2(b_k)) / N     log2(AM) = log2(sum(b_k)) - log2(N)
+    int64_t sum = 0;
+    int64_t log_sum = 0;
+
+    for(int k = 0; k < length; k++){
+        // The geometric mean of anything including a zero is zero.
+        if(b[k] <= 0)
+            return 0;
+
+        sum += b[k];
+        log_sum += log2_q24(b[k]);
+    }
+
+    const right_shift_t sum_shr = MAX(0, 32 - (int) HR_S64(sum));
+    const int32_t log_am = log2_q24((int32_t)(sum >> sum_shr)) + (sum_shr << 24) 
+                         - log2_q24((int32_t) length);
+    const int32_t log_gm = (int32_t)(log_sum / (int64_t) length);
+
+    // GM <= AM, but table interpolation error can leave them slightly the wrong way around.
+    return exp2_q30(MIN(log_gm - log_am, 0));
+}
@@ -0,0 +1,77 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "xs3_math.h"
+#include "vpu_helper.h"
+#include "xs3_vpu_scalar_ops.h"
+
+
+headroom_t xs3_vect_s32_weighted_sum(
+    int32_t a[],
+    const int32_t* const b[],
+    const fixed_s32_t gain_q30[],
+    const right_shift_t b_shr[],
+    const unsigned channels,
+    const unsigned length,
+    const right_shift_t a_shr)
+{
+    for(int k = 0; k < length; k++){
+        vpu_int32_acc_t acc = 0;
+
+        for(int i = 0; i < channels; i++)
+            acc = vlmacc32(acc, ASHR(32)(b[i][k], b_shr[i]), gain_q30[i]);
+
+        a[k] = vlsat32(acc, a_shr);
+    }
+
+    return xs3_vect_s32_headroom(a, length);
+}
+
+
+void xs3_vect_s32_weighted_sum_prepare(
+    exponent_t* a_exp,
+    right_shift_t b_shr[],
+    right_shift_t* a_shr,
+    const exponent_t b_exp[],
+    const headroom_t b_hr[],
+    const fixed_s32_t gain_q30[],
+    const unsigned channels)
+{
+    // Channel i's mantissas are smaller than 2^(31 + b_exp[i] - b_hr[i] - top) once aligned to exponent top.
+    int have_top = 0;
+    exponent_t top = 0;
+
+    for(int i = 0; i < channels; i++){
+        if(gain_q30[i] == 0) continue;
+        const exponent_t e = b_exp[i] - (int) b_hr[i];
+        if(!have_top || e > top) top = e;
+        have_top = 1;
+    }
+
+    // Upper bound on the magnitude of the accumulated sum. Each product is at most 2^(1-d) * |g| plus
+    // rounding, where d is how far below the top channel the channel sits.
+    int64_t bound = 0;
+
+    for(int i = 0; i < channels; i++){
+        if(gain_q30[i] == 0){
+            b_shr[i] = 0;
+            continue;
+        }
+
+        const int64_t g = (gain_q30[i] < 0)? -((int64_t) gain_q30[i]) : gain_q30[i];
+        const int d = top - (b_exp[i] - (int) b_hr[i]);
+
+        b_shr[i] = MIN(top - b_exp[i], 31);
+        bound += ((d < 32)? ((g << 1) >> d) : 0) + 1;
+    }
+
+    right_shift_t shr = 0;
+    while((bound >> shr) > INT32_MAX)
+        shr++;
+
+    *a_shr = shr;
+    *a_exp = top + shr;
+}
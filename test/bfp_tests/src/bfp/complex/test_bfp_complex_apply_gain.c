@@ -0,0 +1,187 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_complex_apply_gain) {
+  RUN_TEST_CASE(bfp_complex_apply_gain, bfp_complex_s32_apply_gain);
+  RUN_TEST_CASE(bfp_complex_apply_gain, bfp_complex_s32_apply_gain_small);
+}
+
+TEST_GROUP(bfp_complex_apply_gain);
+TEST_SETUP(bfp_complex_apply_gain) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_complex_apply_gain) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (512)
+#endif
+
+
+TEST(bfp_complex_apply_gain, bfp_complex_s32_apply_gain)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t A_data[MAX_LEN], B_data[MAX_LEN];
+    int32_t G_data[MAX_LEN];
+
+    bfp_complex_s32_t A, B;
+    bfp_s32_t G;
+
+    struct {
+        double real[MAX_LEN];
+        double imag[MAX_LEN];
+    } Af, Bf;
+
+    double Gf[MAX_LEN];
+
+    complex_s32_t expected[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        bfp_complex_s32_init(&B, B_data, 
+            pseudo_rand_int(&seed, -30, 30),
+            pseudo_rand_uint(&seed, 1, MAX_LEN+1), 0);
+        
+        bfp_complex_s32_init(&A, A_data, 0, B.length, 0);
+
+        B.hr = pseudo_rand_uint(&seed, 0, 28);
+
+        for(int i = 0; i < B.length; i++){
+            B.data[i].re = pseudo_rand_int32(&seed) >> B.hr;
+            B.data[i].im = pseudo_rand_int32(&seed) >> B.hr;
+        }
+        bfp_complex_s32_headroom(&B);
+
+        // Half of the time use Q2.30 gains in [0, 1], otherwise arbitrary real gains
+        if(r & 1){
+            bfp_s32_init(&G, G_data, -30, B.length, 0);
+            for(int i = 0; i < B.length; i++)
+                G.data[i] = pseudo_rand_uint32(&seed) >> 2;
+        } else {
+            bfp_s32_init(&G, G_data, pseudo_rand_int(&seed, -30, 30), B.length, 0);
+            headroom_t g_hr = pseudo_rand_uint(&seed, 0, 28);
+            for(int i = 0; i < B.length; i++)
+                G.data[i] = pseudo_rand_int32(&seed) >> g_hr;
+        }
+        bfp_s32_headroom(&G);
+
+        test_double_from_complex_s32(Bf.real, Bf.imag, &B);
+        test_double_from_s32(Gf, &G);
+
+        for(int i = 0; i < B.length; i++){
+            Af.real[i] = Bf.real[i] * Gf[i];
+            Af.imag[i] = Bf.imag[i] * Gf[i];
+        }
+
+        bfp_complex_s32_apply_gain(&A, &B, &G);
+
+        TEST_ASSERT_EQUAL(B.length, A.length);
+        TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+        test_complex_s32_from_double(expected, Af.real, Af.imag, A.length, A.exp);
+
+        // If neither input has headroom, one of them has its LSb dropped
+        const int32_t threshold = (B.hr + G.hr == 0)? 2 : 1;
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(threshold, expected[i].re, A.data[i].re);
+            TEST_ASSERT_INT32_WITHIN(threshold, expected[i].im, A.data[i].im);
+        }
+
+        // In-place
+        bfp_complex_s32_apply_gain(&B, &B, &G);
+
+        TEST_ASSERT_EQUAL(A.exp, B.exp);
+        TEST_ASSERT_EQUAL(A.hr, B.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) A.data, (int32_t*) B.data, 2*A.length);
+    }
+}
+
+
+TEST(bfp_complex_apply_gain, bfp_complex_s32_apply_gain_small)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t A_data[MAX_LEN], B_data[MAX_LEN];
+    int32_t G_data[MAX_LEN];
+
+    bfp_complex_s32_t A, B;
+    bfp_s32_t G;
+
+    struct {
+        double real[MAX_LEN];
+        double imag[MAX_LEN];
+    } Af, Bf;
+
+    double Gf[MAX_LEN];
+
+    complex_s32_t expected[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        // Full-scale spectrum with small Q2.30 gains (at most 2^-6, and often far lower), as applied to 
+        // noise-only frames by a suppressor.
+        bfp_complex_s32_init(&B, B_data, pseudo_rand_int(&seed, -30, 30), 
+            pseudo_rand_uint(&seed, 1, MAX_LEN+1), 0);
+        bfp_complex_s32_init(&A, A_data, 0, B.length, 0);
+
+        for(int i = 0; i < B.length; i++){
+            B.data[i].re = pseudo_rand_int32(&seed);
+            B.data[i].im = pseudo_rand_int32(&seed);
+        }
+        bfp_complex_s32_headroom(&B);
+
+        const headroom_t g_hr = pseudo_rand_uint(&seed, 7, 20);
+
+        bfp_s32_init(&G, G_data, -30, B.length, 0);
+        for(int i = 0; i < B.length; i++)
+            G.data[i] = pseudo_rand_uint32(&seed) >> (g_hr + 1);
+
+        // The largest spectrum element meets the largest gain, so the output can be full-scale
+        B.data[0].re = INT32_MAX;
+        G.data[0] = INT32_MAX >> g_hr;
+
+        bfp_complex_s32_headroom(&B);
+        bfp_s32_headroom(&G);
+
+        test_double_from_complex_s32(Bf.real, Bf.imag, &B);
+        test_double_from_s32(Gf, &G);
+
+        for(int i = 0; i < B.length; i++){
+            Af.real[i] = Bf.real[i] * Gf[i];
+            Af.imag[i] = Bf.imag[i] * Gf[i];
+        }
+
+        bfp_complex_s32_apply_gain(&A, &B, &G);
+
+        TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+        // The gains' headroom must not be carried into the output
+        TEST_ASSERT_LESS_OR_EQUAL(2, A.hr);
+
+        test_complex_s32_from_double(expected, Af.real, Af.imag, A.length, A.exp);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(1, expected[i].re, A.data[i].re);
+            TEST_ASSERT_INT32_WITHIN(1, expected[i].im, A.data[i].im);
+        }
+    }
+}
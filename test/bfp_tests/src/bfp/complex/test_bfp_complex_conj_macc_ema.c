@@ -0,0 +1,191 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_complex_conj_macc_ema) {
+  RUN_TEST_CASE(bfp_complex_conj_macc_ema, bfp_complex_s32_conj_macc_ema);
+  RUN_TEST_CASE(bfp_complex_conj_macc_ema, bfp_complex_s32_conj_macc_ema_pairs);
+}
+
+TEST_GROUP(bfp_complex_conj_macc_ema);
+TEST_SETUP(bfp_complex_conj_macc_ema) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_complex_conj_macc_ema) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define LEN        (128)
+#else
+#  define REPS       (1000)
+#  define LEN        (512)
+#endif
+
+#define CHANNELS     (4)
+#define PAIRS        (CHANNELS * (CHANNELS + 1) / 2)
+
+
+static void random_frame(
+    bfp_complex_s32_t* x,
+    unsigned* seed)
+{
+    x->exp = 10 + (pseudo_rand_int32(seed) % 10);
+
+    for(int i = 0; i < x->length; i++){
+        unsigned shr = pseudo_rand_uint16(seed) % 8;
+        x->data[i].re = pseudo_rand_int32(seed) >> shr;
+        x->data[i].im = pseudo_rand_int32(seed) >> shr;
+    }
+
+    bfp_complex_s32_headroom(x);
+}
+
+
+TEST(bfp_complex_conj_macc_ema, bfp_complex_s32_conj_macc_ema)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t dataA[LEN];
+    complex_s32_t dataB[LEN];
+    complex_s32_t dataC[LEN];
+    complex_s32_t expA[LEN];
+    bfp_complex_s32_t A, B, C;
+
+    struct {
+      double real[LEN];
+      double imag[LEN];
+    } Af;
+
+    bfp_complex_s32_init(&A, dataA, -1024, LEN, 0);
+    bfp_complex_s32_init(&B, dataB, -1024, LEN, 0);
+    bfp_complex_s32_init(&C, dataC, -1024, LEN, 0);
+
+    complex_s32_t zero = {0,0};
+    bfp_complex_s32_set(&A, zero, -1024);
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        // Include both ends of the coefficient's range
+        const fixed_s32_t alpha = (r == 0)? 0 : (r == 1)? 0x40000000 
+                                : pseudo_rand_uint(&seed, 0, 0x40000001);
+        const double alpha_f = ldexp(alpha, -30);
+
+        random_frame(&B, &seed);
+
+        // Occasionally track the power spectrum of a single vector
+        if(r % 8 == 7)
+            memcpy(&C, &B, sizeof(C));
+        else
+            random_frame(&C, &seed);
+
+        for(int i = 0; i < LEN; i++){
+            const double b_re = ldexp(B.data[i].re, B.exp);
+            const double b_im = ldexp(B.data[i].im, B.exp);
+            const double c_re = ldexp(C.data[i].re, C.exp);
+            const double c_im = ldexp(C.data[i].im, C.exp);
+
+            Af.real[i] = alpha_f * ldexp(A.data[i].re, A.exp) + (1 - alpha_f) * ( b_re * c_re + b_im * c_im);
+            Af.imag[i] = alpha_f * ldexp(A.data[i].im, A.exp) + (1 - alpha_f) * (-b_re * c_im + b_im * c_re);
+        }
+
+        bfp_complex_s32_conj_macc_ema(&A, &B, &C, alpha);
+
+        C.data = dataC;
+
+        TEST_ASSERT_EQUAL(bfp_complex_s32_headroom(&A), A.hr);
+
+        test_complex_s32_from_double(expA, Af.real, Af.imag, LEN, A.exp);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(3, expA[i].re, A.data[i].re);
+            TEST_ASSERT_INT32_WITHIN(3, expA[i].im, A.data[i].im);
+        }
+    }
+}
+
+
+TEST(bfp_complex_conj_macc_ema, bfp_complex_s32_conj_macc_ema_pairs)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t dataX[CHANNELS][LEN];
+    complex_s32_t dataR[PAIRS][LEN];
+    complex_s32_t dataE[PAIRS][LEN];
+    bfp_complex_s32_t X[CHANNELS], R[PAIRS], E[PAIRS];
+
+    for(int c = 0; c < CHANNELS; c++)
+        bfp_complex_s32_init(&X[c], dataX[c], 0, LEN, 0);
+
+    for(int p = 0; p < PAIRS; p++){
+        bfp_complex_s32_init(&R[p], dataR[p], 0, LEN, 0);
+        bfp_complex_s32_init(&E[p], dataE[p], 0, LEN, 0);
+        complex_s32_t zero = {0,0};
+        bfp_complex_s32_set(&R[p], zero, -1024);
+        bfp_complex_s32_set(&E[p], zero, -1024);
+    }
+
+    complex_s32_t expR[LEN];
+
+    struct {
+      double real[LEN];
+      double imag[LEN];
+    } Rf;
+
+    for(int r = 0; r < REPS / 10; r++){
+        setExtraInfo_RS(r, seed);
+
+        const fixed_s32_t alpha = pseudo_rand_uint(&seed, 0, 0x40000001);
+        const double alpha_f = ldexp(alpha, -30);
+
+        for(int c = 0; c < CHANNELS; c++)
+            random_frame(&X[c], &seed);
+
+        // One pair (on the first rep, the last off-diagonal one) is also checked against double precision
+        const unsigned ci = (r == 0)? CHANNELS - 2 : pseudo_rand_uint(&seed, 0, CHANNELS);
+        const unsigned cj = (r == 0)? CHANNELS - 1 : pseudo_rand_uint(&seed, ci, CHANNELS);
+        const unsigned pc = ci * CHANNELS - (ci * (ci - 1)) / 2 + (cj - ci);
+
+        for(int k = 0; k < LEN; k++){
+            const double b_re = ldexp(X[ci].data[k].re, X[ci].exp);
+            const double b_im = ldexp(X[ci].data[k].im, X[ci].exp);
+            const double c_re = ldexp(X[cj].data[k].re, X[cj].exp);
+            const double c_im = ldexp(X[cj].data[k].im, X[cj].exp);
+
+            Rf.real[k] = alpha_f * ldexp(R[pc].data[k].re, R[pc].exp) + (1 - alpha_f) * ( b_re * c_re + b_im * c_im);
+            Rf.imag[k] = alpha_f * ldexp(R[pc].data[k].im, R[pc].exp) + (1 - alpha_f) * (-b_re * c_im + b_im * c_re);
+        }
+
+        bfp_complex_s32_conj_macc_ema_pairs(R, X, CHANNELS, alpha);
+
+        test_complex_s32_from_double(expR, Rf.real, Rf.imag, LEN, R[pc].exp);
+
+        for(int k = 0; k < LEN; k++){
+            TEST_ASSERT_INT32_WITHIN(3, expR[k].re, R[pc].data[k].re);
+            TEST_ASSERT_INT32_WITHIN(3, expR[k].im, R[pc].data[k].im);
+        }
+
+        // Upper triangle in row-major order
+        unsigned p = 0;
+        for(int i = 0; i < CHANNELS; i++)
+            for(int j = i; j < CHANNELS; j++)
+                bfp_complex_s32_conj_macc_ema(&E[p++], &X[i], &X[j], alpha);
+
+        for(int p = 0; p < PAIRS; p++){
+            TEST_ASSERT_EQUAL(E[p].exp, R[p].exp);
+            TEST_ASSERT_EQUAL(E[p].hr, R[p].hr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) E[p].data, (int32_t*) R[p].data, 2 * LEN);
+        }
+    }
+}
@@ -0,0 +1,273 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_complex_hermitian_solve) {
+  RUN_TEST_CASE(bfp_complex_hermitian_solve, bfp_complex_s32_hermitian_solve);
+  RUN_TEST_CASE(bfp_complex_hermitian_solve, bfp_complex_s32_hermitian_solve_singular);
+}
+
+TEST_GROUP(bfp_complex_hermitian_solve);
+TEST_SETUP(bfp_complex_hermitian_solve) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_complex_hermitian_solve) {}
+
+#if SMOKE_TEST
+#  define REPS       (20)
+#else
+#  define REPS       (200)
+#endif
+
+#define MAX_ORDER   (8)
+#define MAX_PAIRS   (MAX_ORDER * (MAX_ORDER + 1) / 2)
+#define BINS        (33)
+
+
+static complex_s32_t dataR[MAX_PAIRS][BINS];
+static complex_s32_t dataB[MAX_ORDER][BINS];
+static complex_s32_t dataX[MAX_ORDER][BINS];
+static int32_t scratch[4 * BINS];
+
+static complex_double_t Rf[BINS][MAX_ORDER][MAX_ORDER];
+static complex_double_t Bf[BINS][MAX_ORDER];
+static complex_double_t Xf[BINS][MAX_ORDER];
+
+
+/*
+ * Quantize one bin-major vector of doubles into a BFP vector with 1 bit of headroom, then replace
+ * the doubles with the values actually represented.
+ */
+static void quantize(
+    bfp_complex_s32_t* a,
+    complex_double_t* v[],
+    const unsigned length)
+{
+    double max = 0;
+    for(int f = 0; f < length; f++)
+        max = fmax(max, fmax(fabs(v[f]->re), fabs(v[f]->im)));
+
+    int e;
+    frexp(max, &e);
+    a->exp = e - 30;
+
+    for(int f = 0; f < length; f++){
+        a->data[f].re = (int32_t) round(ldexp(v[f]->re, -a->exp));
+        a->data[f].im = (int32_t) round(ldexp(v[f]->im, -a->exp));
+        v[f]->re = ldexp(a->data[f].re, a->exp);
+        v[f]->im = ldexp(a->data[f].im, a->exp);
+    }
+
+    bfp_complex_s32_headroom(a);
+}
+
+
+/*
+ * Solve R x = b by Gaussian elimination with partial pivoting, in double precision.
+ */
+static void solve_double(
+    complex_double_t x[],
+    complex_double_t R[MAX_ORDER][MAX_ORDER],
+    const complex_double_t b[],
+    const unsigned order)
+{
+    complex_double_t M[MAX_ORDER][MAX_ORDER + 1];
+
+    for(int i = 0; i < order; i++){
+        for(int j = 0; j < order; j++)
+            M[i][j] = R[i][j];
+        M[i][order] = b[i];
+    }
+
+    for(int c = 0; c < order; c++){
+        int piv = c;
+        for(int i = c + 1; i < order; i++)
+            if(hypot(M[i][c].re, M[i][c].im) > hypot(M[piv][c].re, M[piv][c].im)) piv = i;
+
+        for(int j = 0; j <= order; j++){
+            complex_double_t t = M[c][j]; M[c][j] = M[piv][j]; M[piv][j] = t;
+        }
+
+        const double den = M[c][c].re * M[c][c].re + M[c][c].im * M[c][c].im;
+
+        for(int i = c + 1; i < order; i++){
+            // q = M[i][c] / M[c][c]
+            const complex_double_t q = {
+                (M[i][c].re * M[c][c].re + M[i][c].im * M[c][c].im) / den,
+                (M[i][c].im * M[c][c].re - M[i][c].re * M[c][c].im) / den };
+
+            for(int j = c; j <= order; j++){
+                M[i][j].re -= q.re * M[c][j].re - q.im * M[c][j].im;
+                M[i][j].im -= q.re * M[c][j].im + q.im * M[c][j].re;
+            }
+        }
+    }
+
+    for(int i = order - 1; i >= 0; i--){
+        complex_double_t s = M[i][order];
+        for(int j = i + 1; j < order; j++){
+            s.re -= M[i][j].re * x[j].re - M[i][j].im * x[j].im;
+            s.im -= M[i][j].re * x[j].im + M[i][j].im * x[j].re;
+        }
+        const double den = M[i][i].re * M[i][i].re + M[i][i].im * M[i][i].im;
+        x[i].re = (s.re * M[i][i].re + s.im * M[i][i].im) / den;
+        x[i].im = (s.im * M[i][i].re - s.re * M[i][i].im) / den;
+    }
+}
+
+
+/*
+ * Build a random, well-conditioned Hermitian positive definite matrix and a random right-hand 
+ * side for each bin, each scaled by its own random power of 2, and quantize them into R[] and B[].
+ */
+static void random_problem(
+    bfp_complex_s32_t R[],
+    bfp_complex_s32_t B[],
+    const unsigned order,
+    unsigned* seed)
+{
+    complex_double_t* col[BINS];
+
+    for(int f = 0; f < BINS; f++){
+        const double r_scale = ldexp(1, pseudo_rand_int(seed, -8, 9));
+        const double b_scale = ldexp(1, pseudo_rand_int(seed, -8, 9));
+
+        // R = A A^H + order * I
+        complex_double_t A[MAX_ORDER][MAX_ORDER];
+        for(int i = 0; i < order; i++){
+            for(int j = 0; j < order; j++){
+                A[i][j].re = ldexp(pseudo_rand_int32(seed), -31);
+                A[i][j].im = ldexp(pseudo_rand_int32(seed), -31);
+            }
+            Bf[f][i].re = b_scale * ldexp(pseudo_rand_int32(seed), -31);
+            Bf[f][i].im = b_scale * ldexp(pseudo_rand_int32(seed), -31);
+        }
+
+        for(int i = 0; i < order; i++){
+            for(int j = 0; j < order; j++){
+                complex_double_t s = {(i == j)? order : 0, 0};
+                for(int k = 0; k < order; k++){
+                    s.re += A[i][k].re * A[j][k].re + A[i][k].im * A[j][k].im;
+                    s.im += A[i][k].im * A[j][k].re - A[i][k].re * A[j][k].im;
+                }
+                Rf[f][i][j].re = r_scale * s.re;
+                Rf[f][i][j].im = (i == j)? 0 : r_scale * s.im;
+            }
+        }
+    }
+
+    unsigned p = 0;
+    for(int i = 0; i < order; i++){
+        for(int j = i; j < order; j++){
+            for(int f = 0; f < BINS; f++) col[f] = &Rf[f][i][j];
+            bfp_complex_s32_init(&R[p], dataR[p], 0, BINS, 0);
+            quantize(&R[p], col, BINS);
+
+            // Keep the reference matrix exactly Hermitian after quantization
+            for(int f = 0; f < BINS; f++){
+                Rf[f][j][i].re =  Rf[f][i][j].re;
+                Rf[f][j][i].im = -Rf[f][i][j].im;
+            }
+            p++;
+        }
+
+        for(int f = 0; f < BINS; f++) col[f] = &Bf[f][i];
+        bfp_complex_s32_init(&B[i], dataB[i], 0, BINS, 0);
+        quantize(&B[i], col, BINS);
+    }
+}
+
+
+TEST(bfp_complex_hermitian_solve, bfp_complex_s32_hermitian_solve)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    bfp_complex_s32_t R[MAX_PAIRS], B[MAX_ORDER], X[MAX_ORDER];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned order = 1 + (r % MAX_ORDER);
+
+        random_problem(R, B, order, &seed);
+
+        for(int i = 0; i < order; i++)
+            bfp_complex_s32_init(&X[i], dataX[i], 0, BINS, 0);
+
+        // Solve in-place on the right-hand side every other time
+        bfp_complex_s32_t* out = (r & 1)? B : X;
+        bfp_complex_s32_hermitian_solve(out, R, B, order, scratch);
+
+        for(int f = 0; f < BINS; f++){
+            solve_double(Xf[f], Rf[f], Bf[f], order);
+
+            for(int i = 0; i < order; i++){
+                // The solution of a well-conditioned system is accurate to a few LSbs of the
+                // output vector's (shared) exponent, plus a small relative error.
+                const double tol = ldexp(1, out[i].exp + 4) + 1e-5 * hypot(Xf[f][i].re, Xf[f][i].im);
+                TEST_ASSERT_DOUBLE_WITHIN(tol, Xf[f][i].re, ldexp(out[i].data[f].re, out[i].exp));
+                TEST_ASSERT_DOUBLE_WITHIN(tol, Xf[f][i].im, ldexp(out[i].data[f].im, out[i].exp));
+            }
+        }
+
+        for(int i = 0; i < order; i++){
+            TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(out[i].data, BINS), out[i].hr);
+        }
+    }
+}
+
+
+TEST(bfp_complex_hermitian_solve, bfp_complex_s32_hermitian_solve_singular)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    bfp_complex_s32_t R[MAX_PAIRS], B[MAX_ORDER], X[MAX_ORDER];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned order = 2 + (r % (MAX_ORDER - 1));
+
+        random_problem(R, B, order, &seed);
+
+        // Zero one bin's matrix, and make another bin's matrix singular by giving it two equal
+        // rows (and columns).
+        const unsigned zero_bin = pseudo_rand_uint(&seed, 0, BINS);
+        const unsigned sing_bin = (zero_bin + 1 + pseudo_rand_uint(&seed, 0, BINS - 1)) % BINS;
+
+        for(int p = 0; p < (order * (order + 1)) / 2; p++){
+            R[p].data[zero_bin].re = 0;
+            R[p].data[zero_bin].im = 0;
+        }
+
+        // Rows 0 and 1 equal: R_00 = R_01 = R_11 and R_0j = R_1j
+        R[0].data[sing_bin] = R[1].data[sing_bin] = R[order].data[sing_bin];
+        R[0].data[sing_bin].im = R[1].data[sing_bin].im = R[order].data[sing_bin].im = 0;
+        R[1].exp = R[order].exp = R[0].exp;
+        for(int j = 2; j < order; j++)
+            R[order + j - 1].data[sing_bin] = R[j].data[sing_bin];
+
+        for(int i = 0; i < order; i++)
+            bfp_complex_s32_init(&X[i], dataX[i], 0, BINS, 0);
+
+        bfp_complex_s32_hermitian_solve(X, R, B, order, scratch);
+
+        for(int i = 0; i < order; i++){
+            TEST_ASSERT_EQUAL_INT32(0, X[i].data[zero_bin].re);
+            TEST_ASSERT_EQUAL_INT32(0, X[i].data[zero_bin].im);
+            TEST_ASSERT_EQUAL_INT32(0, X[i].data[sing_bin].re);
+            TEST_ASSERT_EQUAL_INT32(0, X[i].data[sing_bin].im);
+        }
+    }
+}
@@ -0,0 +1,216 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_complex_planar) {
+  RUN_TEST_CASE(bfp_complex_planar, bfp_complex_s32_to_from_planar);
+  RUN_TEST_CASE(bfp_complex_planar, bfp_complex_s32_planar_mul);
+  RUN_TEST_CASE(bfp_complex_planar, bfp_complex_s32_planar_macc);
+  RUN_TEST_CASE(bfp_complex_planar, bfp_complex_s32_planar_mag);
+}
+
+TEST_GROUP(bfp_complex_planar);
+TEST_SETUP(bfp_complex_planar) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_complex_planar) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (512)
+#endif
+
+
+/*
+ * The planar functions are specified to give results identical to their interleaved counterparts,
+ * so each is checked against the interleaved function applied to the same random inputs.
+ */
+
+
+TEST(bfp_complex_planar, bfp_complex_s32_to_from_planar)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t dataB[MAX_LEN];
+    complex_s32_t dataA[MAX_LEN];
+    int32_t real[MAX_LEN];
+    int32_t imag[MAX_LEN];
+
+    bfp_complex_s32_t A, B;
+    bfp_complex_s32_planar_t P;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        B.data = dataB;
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        bfp_complex_s32_init(&A, dataA, 0, B.length, 0);
+        bfp_complex_s32_planar_init(&P, real, imag, 0, B.length, 0);
+
+        bfp_complex_s32_to_planar(&P, &B);
+
+        TEST_ASSERT_EQUAL(B.exp, P.exp);
+        TEST_ASSERT_EQUAL(B.hr, P.hr);
+        TEST_ASSERT_EQUAL(B.hr, bfp_complex_s32_planar_headroom(&P));
+
+        for(int i = 0; i < B.length; i++){
+            TEST_ASSERT_EQUAL_INT32(B.data[i].re, P.real[i]);
+            TEST_ASSERT_EQUAL_INT32(B.data[i].im, P.imag[i]);
+        }
+
+        bfp_complex_s32_from_planar(&A, &P);
+
+        TEST_ASSERT_EQUAL(B.exp, A.exp);
+        TEST_ASSERT_EQUAL(B.hr, A.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) B.data, (int32_t*) A.data, 2 * B.length);
+    }
+}
+
+
+TEST(bfp_complex_planar, bfp_complex_s32_planar_mul)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t dataA[MAX_LEN];
+    complex_s32_t dataB[MAX_LEN];
+    complex_s32_t dataC[MAX_LEN];
+    struct {
+        int32_t real[MAX_LEN];
+        int32_t imag[MAX_LEN];
+    } pA, pB, pC;
+
+    bfp_complex_s32_t A, B, C;
+    bfp_complex_s32_planar_t PA, PB, PC;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        A.data = dataA;
+        B.data = dataB;
+        C.data = dataC;
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_complex_s32(&C, MAX_LEN, &seed, &A, B.length);
+
+        bfp_complex_s32_planar_init(&PA, pA.real, pA.imag, 0, B.length, 0);
+        bfp_complex_s32_planar_init(&PB, pB.real, pB.imag, 0, B.length, 0);
+        bfp_complex_s32_planar_init(&PC, pC.real, pC.imag, 0, B.length, 0);
+        bfp_complex_s32_to_planar(&PB, &B);
+        bfp_complex_s32_to_planar(&PC, &C);
+
+        // Multiply
+        bfp_complex_s32_planar_mul(&PA, &PB, &PC);
+        bfp_complex_s32_mul(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(A.exp, PA.exp);
+        TEST_ASSERT_EQUAL(A.hr, PA.hr);
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_EQUAL_INT32(A.data[i].re, PA.real[i]);
+            TEST_ASSERT_EQUAL_INT32(A.data[i].im, PA.imag[i]);
+        }
+
+        // Conjugate multiply, in-place on b
+        bfp_complex_s32_conj_mul(&A, &B, &C);
+        bfp_complex_s32_planar_conj_mul(&PB, &PB, &PC);
+
+        TEST_ASSERT_EQUAL(A.exp, PB.exp);
+        TEST_ASSERT_EQUAL(A.hr, PB.hr);
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_EQUAL_INT32(A.data[i].re, PB.real[i]);
+            TEST_ASSERT_EQUAL_INT32(A.data[i].im, PB.imag[i]);
+        }
+    }
+}
+
+
+TEST(bfp_complex_planar, bfp_complex_s32_planar_macc)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t dataA[MAX_LEN];
+    complex_s32_t dataB[MAX_LEN];
+    complex_s32_t dataC[MAX_LEN];
+    struct {
+        int32_t real[MAX_LEN];
+        int32_t imag[MAX_LEN];
+    } pA, pB, pC;
+
+    bfp_complex_s32_t A, B, C;
+    bfp_complex_s32_planar_t PA, PB, PC;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        A.data = dataA;
+        B.data = dataB;
+        C.data = dataC;
+        test_random_bfp_complex_s32(&A, MAX_LEN, &seed, NULL, 0);
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, &A, A.length);
+        test_random_bfp_complex_s32(&C, MAX_LEN, &seed, &A, A.length);
+
+        bfp_complex_s32_planar_init(&PA, pA.real, pA.imag, 0, A.length, 0);
+        bfp_complex_s32_planar_init(&PB, pB.real, pB.imag, 0, A.length, 0);
+        bfp_complex_s32_planar_init(&PC, pC.real, pC.imag, 0, A.length, 0);
+        bfp_complex_s32_to_planar(&PA, &A);
+        bfp_complex_s32_to_planar(&PB, &B);
+        bfp_complex_s32_to_planar(&PC, &C);
+
+        bfp_complex_s32_planar_macc(&PA, &PB, &PC);
+        bfp_complex_s32_macc(&A, &B, &C);
+
+        TEST_ASSERT_EQUAL(A.exp, PA.exp);
+        TEST_ASSERT_EQUAL(A.hr, PA.hr);
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_EQUAL_INT32(A.data[i].re, PA.real[i]);
+            TEST_ASSERT_EQUAL_INT32(A.data[i].im, PA.imag[i]);
+        }
+    }
+}
+
+
+TEST(bfp_complex_planar, bfp_complex_s32_planar_mag)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataPA[MAX_LEN];
+    complex_s32_t dataB[MAX_LEN];
+    int32_t real[MAX_LEN];
+    int32_t imag[MAX_LEN];
+
+    bfp_s32_t A, PA;
+    bfp_complex_s32_t B;
+    bfp_complex_s32_planar_t PB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        B.data = dataB;
+        test_random_bfp_complex_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        bfp_s32_init(&A, dataA, 0, B.length, 0);
+        bfp_s32_init(&PA, dataPA, 0, B.length, 0);
+        bfp_complex_s32_planar_init(&PB, real, imag, 0, B.length, 0);
+        bfp_complex_s32_to_planar(&PB, &B);
+
+        bfp_complex_s32_mag(&A, &B);
+        bfp_complex_s32_planar_mag(&PA, &PB);
+
+        TEST_ASSERT_EQUAL(A.exp, PA.exp);
+        TEST_ASSERT_EQUAL(A.hr, PA.hr);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(A.data, PA.data, A.length);
+    }
+}
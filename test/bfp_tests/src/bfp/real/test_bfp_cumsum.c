@@ -0,0 +1,61 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_cumsum) {
+  RUN_TEST_CASE(bfp_cumsum, bfp_s32_cumsum);
+}
+
+TEST_GROUP(bfp_cumsum);
+TEST_SETUP(bfp_cumsum) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_cumsum) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_cumsum, bfp_s32_cumsum)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    double A_flt[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t A, B;
+
+    A.data = dataA;
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_double_from_s32(B_flt, &B);
+
+        bfp_s32_cumsum(&A, &B);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&A), A.hr);
+        test_double_from_s32(A_flt, &A);
+
+        // Partial sums are exact in double, and each output is rounded only once
+        double expected = 0;
+        for(int i = 0; i < B.length; i++){
+            expected += B_flt[i];
+            TEST_ASSERT(fabs(A_flt[i] - expected) <= ldexp(1, A.exp - 1));
+        }
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_delay_and_sum) {
+  RUN_TEST_CASE(bfp_delay_and_sum, bfp_s32_delay_and_sum);
+  RUN_TEST_CASE(bfp_delay_and_sum, bfp_s32_delay_and_sum_unity);
+}
+
+TEST_GROUP(bfp_delay_and_sum);
+TEST_SETUP(bfp_delay_and_sum) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_delay_and_sum) {}
+
+#define REPS        200
+#define MAX_CHANS   16
+#define MAX_LEN     64
+#define MAX_DELAY   16
+#define MAX_HIST    (MAX_DELAY + 8)
+
+
+TEST(bfp_delay_and_sum, bfp_s32_delay_and_sum)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_CHANS][MAX_LEN + MAX_HIST];
+    double A_flt[MAX_LEN];
+    double B_flt[MAX_LEN + MAX_HIST];
+    double expected[MAX_LEN];
+    bfp_s32_t A, B[MAX_CHANS];
+    fixed_s32_t gain[MAX_CHANS];
+    unsigned delay[MAX_CHANS];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned channels = pseudo_rand_uint(&seed, 1, MAX_CHANS+1);
+        const unsigned N = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        bfp_s32_init(&A, dataA, 0, N, 0);
+        memset(expected, 0, sizeof(expected));
+
+        for(int i = 0; i < channels; i++){
+            delay[i] = pseudo_rand_uint(&seed, 0, MAX_DELAY+1);
+            gain[i] = pseudo_rand_int(&seed, -0x7FFFFFFF, 0x7FFFFFFF);
+
+            // Some channels are muted
+            if(pseudo_rand_uint(&seed, 0, 8) == 0)
+                gain[i] = 0;
+
+            const unsigned len = N + delay[i] + pseudo_rand_uint(&seed, 0, MAX_HIST - MAX_DELAY + 1);
+
+            B[i].data = dataB[i];
+            test_random_bfp_s32(&B[i], 0, &seed, NULL, len);
+            test_double_from_s32(B_flt, &B[i]);
+
+            for(int k = 0; k < N; k++)
+                expected[k] += ldexp(gain[i], -30) * B_flt[len - N + k - delay[i]];
+        }
+
+        bfp_s32_delay_and_sum(&A, B, gain, delay, channels);
+
+        TEST_ASSERT_EQUAL(N, A.length);
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&A), A.hr);
+        test_double_from_s32(A_flt, &A);
+
+        // Each channel contributes at most a few LSBs of truncation and rounding error at the common exponent
+        const double tol = ldexp(3 * channels + 1, A.exp);
+
+        for(int k = 0; k < N; k++)
+            TEST_ASSERT(fabs(A_flt[k] - expected[k]) <= tol);
+    }
+}
+
+
+TEST(bfp_delay_and_sum, bfp_s32_delay_and_sum_unity)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN + MAX_DELAY];
+    double A_flt[MAX_LEN];
+    double B_flt[MAX_LEN + MAX_DELAY];
+    bfp_s32_t A, B;
+    const fixed_s32_t gain = 0x40000000;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned N = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const unsigned delay = pseudo_rand_uint(&seed, 0, MAX_DELAY+1);
+
+        bfp_s32_init(&A, dataA, 0, N, 0);
+        test_random_bfp_s32(&B, 0, &seed, NULL, N + delay);
+        test_double_from_s32(B_flt, &B);
+
+        bfp_s32_delay_and_sum(&A, &B, &gain, &delay, 1);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&A), A.hr);
+        test_double_from_s32(A_flt, &A);
+
+        // A single channel with unit weight is just a (delayed) copy
+        for(int k = 0; k < N; k++)
+            TEST_ASSERT_EQUAL(B_flt[k], A_flt[k]);
+    }
+}
@@ -0,0 +1,162 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_elementwise) {
+  RUN_TEST_CASE(bfp_elementwise, bfp_s32_max_elementwise);
+  RUN_TEST_CASE(bfp_elementwise, bfp_s32_min_elementwise);
+  RUN_TEST_CASE(bfp_elementwise, bfp_s32_select);
+}
+
+TEST_GROUP(bfp_elementwise);
+TEST_SETUP(bfp_elementwise) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_elementwise) {}
+
+#define REPS        1000
+#define MAX_LEN     18  //Smaller lengths mean larger variance w.r.t. individual element headroom
+
+
+TEST(bfp_elementwise, bfp_s32_max_elementwise)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = MAX(Bf[i], Cf[i]);
+        }
+
+        bfp_s32_max_elementwise(&A, &B, &C);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(1, expA[i], A.data[i]);
+        }
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+    }
+}
+
+
+TEST(bfp_elementwise, bfp_s32_min_elementwise)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            Af[i] = MIN(Bf[i], Cf[i]);
+        }
+
+        bfp_s32_min_elementwise(&A, &B, &C);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(1, expA[i], A.data[i]);
+        }
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+    }
+}
+
+
+TEST(bfp_elementwise, bfp_s32_select)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    int32_t dataC[MAX_LEN];
+    int32_t expA[MAX_LEN];
+    int8_t mask[MAX_LEN];
+    bfp_s32_t A, B, C;
+
+    A.data = dataA;
+    B.data = dataB;
+    C.data = dataC;
+
+    double Af[MAX_LEN];
+    double Bf[MAX_LEN];
+    double Cf[MAX_LEN];
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+        test_random_bfp_s32(&C, MAX_LEN, &seed, &A, B.length);
+
+        test_double_from_s32(Bf, &B);
+        test_double_from_s32(Cf, &C);
+
+        for(int i = 0; i < B.length; i++){
+            mask[i] = pseudo_rand_uint32(&seed) & 1;
+            Af[i] = mask[i]? Bf[i] : Cf[i];
+        }
+
+        bfp_s32_select(&A, &B, &C, mask);
+
+        test_s32_from_double(expA, Af, MAX_LEN, A.exp);
+
+        for(int i = 0; i < A.length; i++){
+            TEST_ASSERT_INT32_WITHIN(1, expA[i], A.data[i]);
+        }
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_percentile) {
+  RUN_TEST_CASE(bfp_percentile, bfp_s32_percentile);
+}
+
+TEST_GROUP(bfp_percentile);
+TEST_SETUP(bfp_percentile) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_percentile) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+static int compare_s32(const void* a, const void* b)
+{
+    const int32_t x = *(const int32_t*)a;
+    const int32_t y = *(const int32_t*)b;
+    return (x > y) - (x < y);
+}
+
+
+TEST(bfp_percentile, bfp_s32_percentile)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    int32_t original[MAX_LEN];
+    int32_t sorted[MAX_LEN];
+    int32_t WORD_ALIGNED scratch[MAX_LEN];
+    bfp_s32_t B;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        // Sometimes full-scale, or with most elements the same
+        const unsigned variant = pseudo_rand_uint(&seed, 0, 3);
+        if(variant == 1){
+            for(int i = 0; i < B.length; i++)
+                B.data[i] = pseudo_rand_int32(&seed);
+        } else if(variant == 2){
+            for(int i = 0; i < B.length; i++)
+                B.data[i] = (pseudo_rand_uint32(&seed) % 8)? 1000 : B.data[i];
+        }
+        bfp_s32_headroom(&B);
+
+        memcpy(original, B.data, B.length * sizeof(int32_t));
+        memcpy(sorted, B.data, B.length * sizeof(int32_t));
+        qsort(sorted, B.length, sizeof(int32_t), compare_s32);
+
+        const fixed_s32_t p = (r % 8 == 0)? 0 
+                            : (r % 8 == 1)? 0x40000000 
+                            : (r % 8 == 2)? 0x20000000 
+                            : pseudo_rand_uint(&seed, 0, 0x40000001);
+
+        const unsigned rank = (((int64_t)p) * (B.length - 1)) >> 30;
+
+        const float_s32_t result = bfp_s32_percentile(&B, p, scratch);
+
+        TEST_ASSERT_EQUAL_INT32(sorted[rank], result.mant);
+        TEST_ASSERT_EQUAL_INT32(B.exp, result.exp);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(original, B.data, B.length);
+    }
+}
@@ -0,0 +1,98 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_pyramid) {
+  RUN_TEST_CASE(bfp_pyramid, bfp_s32_pyramid);
+}
+
+TEST_GROUP(bfp_pyramid);
+TEST_SETUP(bfp_pyramid) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_pyramid) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_pyramid, bfp_s32_pyramid)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    int32_t dataM[MAX_LEN];
+    int32_t datam[MAX_LEN];
+    int32_t dataP[MAX_LEN];
+    double B_flt[MAX_LEN];
+    double M_flt[MAX_LEN];
+    double m_flt[MAX_LEN];
+    double P_flt[MAX_LEN];
+    bfp_s32_t B, M, m, P;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned levels = pseudo_rand_uint(&seed, 1, 6);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, (MAX_LEN >> levels) + 1) << levels;
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, len);
+        test_double_from_s32(B_flt, &B);
+
+        const unsigned out_len = B.length - (B.length >> levels);
+        bfp_s32_init(&M, dataM, 0, out_len, 0);
+        bfp_s32_init(&m, datam, 0, out_len, 0);
+        bfp_s32_init(&P, dataP, 0, out_len, 0);
+
+        bfp_s32_pyramid(&M, &m, &P, &B, levels);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&M), M.hr);
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&m), m.hr);
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&P), P.hr);
+
+        test_double_from_s32(M_flt, &M);
+        test_double_from_s32(m_flt, &m);
+        test_double_from_s32(P_flt, &P);
+
+        // Largest possible mean-square, for scaling the tolerance
+        const double full_scale = ldexp(1, 2 * (B.exp + 31 - B.hr));
+
+        unsigned offset = 0;
+        for(int l = 1; l <= levels; l++){
+            const unsigned block = 1 << l;
+
+            for(int k = 0; k < (B.length >> l); k++){
+                double exp_max = -INFINITY;
+                double exp_min = INFINITY;
+                double exp_ms = 0;
+
+                for(int i = k * block; i < (k+1) * block; i++){
+                    exp_max = MAX(exp_max, B_flt[i]);
+                    exp_min = MIN(exp_min, B_flt[i]);
+                    exp_ms += B_flt[i] * B_flt[i];
+                }
+                exp_ms /= block;
+
+                TEST_ASSERT(M_flt[offset + k] == exp_max);
+                TEST_ASSERT(m_flt[offset + k] == exp_min);
+                TEST_ASSERT(fabs(P_flt[offset + k] - exp_ms) <= ldexp(full_scale, -28));
+            }
+
+            offset += B.length >> l;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_smooth) {
+  RUN_TEST_CASE(bfp_smooth, bfp_s32_smooth);
+  RUN_TEST_CASE(bfp_smooth, bfp_s32_smooth_vect);
+}
+
+TEST_GROUP(bfp_smooth);
+TEST_SETUP(bfp_smooth) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_smooth) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_smooth, bfp_s32_smooth)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataY[MAX_LEN];
+    int32_t dataX[MAX_LEN];
+    double Y_flt[MAX_LEN];
+    double X_flt[MAX_LEN];
+    bfp_s32_t Y, X;
+
+    Y.data = dataY;
+    X.data = dataX;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&Y, MAX_LEN, &seed, &X, 0);
+        test_random_bfp_s32(&X, MAX_LEN, &seed, NULL, Y.length);
+
+        // Keep the exponents within a range where neither vector vanishes entirely
+        X.exp = Y.exp + pseudo_rand_int(&seed, -8, 9);
+
+        const fixed_s32_t coef = pseudo_rand_uint(&seed, 0, 0x40000001);
+        const double c = ldexp(coef, -30);
+
+        test_double_from_s32(Y_flt, &Y);
+        test_double_from_s32(X_flt, &X);
+
+        bfp_s32_smooth(&Y, &X, coef);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&Y), Y.hr);
+
+        for(int i = 0; i < Y.length; i++){
+            const double expected = Y_flt[i] + c * (X_flt[i] - Y_flt[i]);
+            TEST_ASSERT(fabs(ldexp(Y.data[i], Y.exp) - expected) <= ldexp(3, Y.exp));
+        }
+    }
+}
+
+
+TEST(bfp_smooth, bfp_s32_smooth_vect)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataY[MAX_LEN];
+    int32_t dataX[MAX_LEN];
+    fixed_s32_t coef[MAX_LEN];
+    double Y_flt[MAX_LEN];
+    double X_flt[MAX_LEN];
+    bfp_s32_t Y, X;
+
+    Y.data = dataY;
+    X.data = dataX;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&Y, MAX_LEN, &seed, &X, 0);
+        test_random_bfp_s32(&X, MAX_LEN, &seed, NULL, Y.length);
+
+        X.exp = Y.exp + pseudo_rand_int(&seed, -8, 9);
+
+        for(int i = 0; i < Y.length; i++)
+            coef[i] = pseudo_rand_uint(&seed, 0, 0x40000001);
+
+        test_double_from_s32(Y_flt, &Y);
+        test_double_from_s32(X_flt, &X);
+
+        bfp_s32_smooth_vect(&Y, &X, coef);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&Y), Y.hr);
+
+        for(int i = 0; i < Y.length; i++){
+            const double expected = Y_flt[i] + ldexp(coef[i], -30) * (X_flt[i] - Y_flt[i]);
+            TEST_ASSERT(fabs(ldexp(Y.data[i], Y.exp) - expected) <= ldexp(3, Y.exp));
+        }
+    }
+}
@@ -0,0 +1,74 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_softclip) {
+  RUN_TEST_CASE(bfp_softclip, bfp_s32_softclip);
+}
+
+TEST_GROUP(bfp_softclip);
+TEST_SETUP(bfp_softclip) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_softclip) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+// Absolute error threshold
+#define THRESHOLD   (ldexp(1, -16))
+
+
+TEST(bfp_softclip, bfp_s32_softclip)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    double A_flt[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t A, B;
+
+    A.data = dataA;
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, &A, 0);
+
+        // Values mostly within a few units of zero
+        B.exp = pseudo_rand_int(&seed, -34, -26);
+
+        test_double_from_s32(B_flt, &B);
+
+        const softclip_curve_e curve = (r & 1)? SOFTCLIP_TANH : SOFTCLIP_CUBIC;
+
+        bfp_s32_softclip(&A, &B, curve);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(&A), A.hr);
+        test_double_from_s32(A_flt, &A);
+
+        for(int i = 0; i < B.length; i++){
+            double expected;
+            if(curve == SOFTCLIP_TANH){
+                expected = tanh(MIN(MAX(B_flt[i], -2), 2));
+            } else {
+                const double u = MIN(MAX(B_flt[i], -1), 1);
+                expected = (3 * u - u * u * u) / 2;
+            }
+            TEST_ASSERT(fabs(A_flt[i] - expected) <= THRESHOLD);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_stats) {
+  RUN_TEST_CASE(bfp_stats, bfp_s32_stats);
+}
+
+TEST_GROUP(bfp_stats);
+TEST_SETUP(bfp_stats) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_stats) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_stats, bfp_s32_stats)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    bfp_s32_t B;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        bfp_s32_stats_t stats;
+        bfp_s32_stats(&stats, &B);
+
+        const float_s32_t max = bfp_s32_max(&B);
+        const float_s32_t min = bfp_s32_min(&B);
+        const float_s64_t sum = bfp_s32_sum(&B);
+        const float_s32_t mean = bfp_s32_mean(&B);
+        const float_s64_t energy = bfp_s32_energy(&B);
+
+        TEST_ASSERT_EQUAL_INT32(max.mant, stats.max.mant);
+        TEST_ASSERT_EQUAL_INT32(max.exp, stats.max.exp);
+        TEST_ASSERT_EQUAL_INT32(min.mant, stats.min.mant);
+        TEST_ASSERT_EQUAL_INT32(min.exp, stats.min.exp);
+        TEST_ASSERT_EQUAL_UINT32(bfp_s32_argmax(&B), stats.argmax);
+        TEST_ASSERT_EQUAL_UINT32(bfp_s32_argmin(&B), stats.argmin);
+        TEST_ASSERT_EQUAL_INT64(sum.mant, stats.sum.mant);
+        TEST_ASSERT_EQUAL_INT32(sum.exp, stats.sum.exp);
+        TEST_ASSERT_EQUAL_INT32(mean.mant, stats.mean.mant);
+        TEST_ASSERT_EQUAL_INT32(mean.exp, stats.mean.exp);
+        TEST_ASSERT_EQUAL_INT64(energy.mant, stats.energy.mant);
+        TEST_ASSERT_EQUAL_INT32(energy.exp, stats.energy.exp);
+    }
+}
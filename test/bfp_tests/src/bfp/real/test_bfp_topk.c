@@ -0,0 +1,73 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_topk) {
+  RUN_TEST_CASE(bfp_topk, bfp_s32_topk);
+}
+
+TEST_GROUP(bfp_topk);
+TEST_SETUP(bfp_topk) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_topk) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_topk, bfp_s32_topk)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    bfp_s32_t B;
+
+    unsigned indices[MAX_LEN];
+    float_s32_t values[MAX_LEN];
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        const unsigned K = pseudo_rand_uint(&seed, 1, B.length+1);
+
+        bfp_s32_topk(indices, values, &B, K);
+
+        TEST_ASSERT_EQUAL_UINT32(bfp_s32_argmax(&B), indices[0]);
+
+        for(int j = 0; j < K; j++){
+            TEST_ASSERT_EQUAL_INT32(B.data[indices[j]], values[j].mant);
+            TEST_ASSERT_EQUAL_INT32(B.exp, values[j].exp);
+
+            // Non-increasing values, with no index repeated
+            if(j > 0)
+                TEST_ASSERT(values[j].mant <= values[j-1].mant);
+            for(int i = 0; i < j; i++)
+                TEST_ASSERT_NOT_EQUAL(indices[i], indices[j]);
+        }
+
+        // No unselected element exceeds the smallest selected one
+        unsigned selected[MAX_LEN] = {0};
+        for(int j = 0; j < K; j++)
+            selected[indices[j]] = 1;
+
+        for(int i = 0; i < B.length; i++){
+            if(!selected[i])
+                TEST_ASSERT(B.data[i] <= values[K-1].mant);
+        }
+    }
+}
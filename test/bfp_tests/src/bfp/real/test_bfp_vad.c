@@ -0,0 +1,99 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_vad) {
+  RUN_TEST_CASE(bfp_vad, bfp_s32_energy_zcr);
+  RUN_TEST_CASE(bfp_vad, bfp_s32_spectral_flatness);
+}
+
+TEST_GROUP(bfp_vad);
+TEST_SETUP(bfp_vad) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_vad) {}
+
+#define REPS        1000
+#define MAX_LEN     256
+
+
+TEST(bfp_vad, bfp_s32_energy_zcr)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t B;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, 0);
+        test_double_from_s32(B_flt, &B);
+
+        double expected = 0;
+        unsigned expected_zc = 0;
+        for(int i = 0; i < B.length; i++){
+            expected += B_flt[i] * B_flt[i];
+            if(i > 0)
+                expected_zc += ((B_flt[i] < 0) != (B_flt[i-1] < 0));
+        }
+
+        unsigned zc;
+        float_s64_t result = bfp_s32_energy_zcr(&zc, &B);
+
+        TEST_ASSERT_EQUAL_UINT(expected_zc, zc);
+
+        const double diff = expected - ldexp(result.mant, result.exp);
+        TEST_ASSERT(fabs(diff / expected) <= ldexp(1, -20));
+    }
+}
+
+
+TEST(bfp_vad, bfp_s32_spectral_flatness)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t B;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        test_random_bfp_s32(&B, MAX_LEN, &seed, NULL, 0);
+
+        // Power spectrum: positive values
+        for(int i = 0; i < B.length; i++)
+            B.data[i] = MAX(1, (B.data[i] < 0)? -B.data[i] : B.data[i]);
+
+        test_double_from_s32(B_flt, &B);
+
+        double log_sum = 0;
+        double sum = 0;
+        for(int i = 0; i < B.length; i++){
+            log_sum += log(B_flt[i]);
+            sum += B_flt[i];
+        }
+        const double expected = exp(log_sum / B.length) / (sum / B.length);
+
+        const fixed_s32_t result = bfp_s32_spectral_flatness(&B);
+
+        TEST_ASSERT(fabs(ldexp(result, -30) - expected) <= ldexp(1, -13));
+    }
+}
@@ -0,0 +1,177 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_variance) {
+  RUN_TEST_CASE(bfp_variance, bfp_s32_variance);
+  RUN_TEST_CASE(bfp_variance, bfp_s32_normalize);
+  RUN_TEST_CASE(bfp_variance, bfp_s32_normalize_constant);
+}
+
+TEST_GROUP(bfp_variance);
+TEST_SETUP(bfp_variance) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_variance) {}
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+// Relative error threshold for the variance and standard deviation
+#define VAR_THRESHOLD     (ldexp(1, -16))
+// Absolute error threshold for normalized elements
+#define NORM_THRESHOLD    (ldexp(1, -16))
+
+
+/*
+ * Random vector, half of the time with a mean much larger than its spread.
+ */
+static void random_vector(
+    bfp_s32_t* B,
+    double B_flt[],
+    unsigned* seed)
+{
+    test_random_bfp_s32(B, MAX_LEN, seed, NULL, 0);
+
+    if(pseudo_rand_uint32(seed) & 1){
+        const int32_t offset = 0x20000000 >> B->hr;
+        for(int i = 0; i < B->length; i++)
+            B->data[i] = offset + (B->data[i] >> 8);
+        bfp_s32_headroom(B);
+    }
+
+    test_double_from_s32(B_flt, B);
+}
+
+
+static double mean_double(
+    const double b[],
+    const unsigned length)
+{
+    double mean = 0;
+    for(int i = 0; i < length; i++)
+        mean += b[i];
+    return mean / length;
+}
+
+
+static double variance_double(
+    const double b[],
+    const unsigned length)
+{
+    const double mean = mean_double(b, length);
+    double var = 0;
+    for(int i = 0; i < length; i++)
+        var += (b[i] - mean) * (b[i] - mean);
+    return var / length;
+}
+
+
+TEST(bfp_variance, bfp_s32_variance)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataB[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t B;
+
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        random_vector(&B, B_flt, &seed);
+
+        const double expected = variance_double(B_flt, B.length);
+
+        const double var = float_s32_to_double(bfp_s32_variance(&B));
+        const double std = float_s32_to_double(bfp_s32_std(&B));
+
+        TEST_ASSERT(fabs(var - expected) <= VAR_THRESHOLD * expected);
+        TEST_ASSERT(fabs(std - sqrt(expected)) <= VAR_THRESHOLD * sqrt(expected));
+    }
+}
+
+
+TEST(bfp_variance, bfp_s32_normalize)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    double A_flt[MAX_LEN];
+    double B_flt[MAX_LEN];
+    bfp_s32_t A, B;
+
+    A.data = dataA;
+    B.data = dataB;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        random_vector(&B, B_flt, &seed);
+        A.length = B.length;
+
+        const double mean = mean_double(B_flt, B.length);
+        const double std = sqrt(variance_double(B_flt, B.length));
+
+        // Alternate between out-of-place and in-place
+        bfp_s32_t* out = (r & 1)? &B : &A;
+        bfp_s32_normalize(out, &B);
+
+        TEST_ASSERT_EQUAL(bfp_s32_headroom(out), out->hr);
+
+        test_double_from_s32(A_flt, out);
+
+        for(int i = 0; i < B.length; i++){
+            // (A single-element vector has no spread, and normalizes to zero)
+            const double expected = (std == 0)? 0 : (B_flt[i] - mean) / std;
+            TEST_ASSERT(fabs(A_flt[i] - expected) <= NORM_THRESHOLD * MAX(1, fabs(expected)));
+        }
+    }
+}
+
+
+TEST(bfp_variance, bfp_s32_normalize_constant)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t dataA[MAX_LEN];
+    int32_t dataB[MAX_LEN];
+    bfp_s32_t A, B;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+        const int32_t value = pseudo_rand_int32(&seed);
+
+        bfp_s32_init(&B, dataB, pseudo_rand_int(&seed, -40, 0), len, 0);
+        bfp_s32_init(&A, dataA, 0, len, 0);
+        bfp_s32_set(&B, value, B.exp);
+
+        const float_s32_t var = bfp_s32_variance(&B);
+        TEST_ASSERT_EQUAL_INT32(0, var.mant);
+
+        bfp_s32_normalize(&A, &B);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(0, A.data[i]);
+    }
+}
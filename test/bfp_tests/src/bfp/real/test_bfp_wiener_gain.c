@@ -0,0 +1,191 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_wiener_gain) {
+  RUN_TEST_CASE(bfp_wiener_gain, bfp_s32_wiener_gain);
+  RUN_TEST_CASE(bfp_wiener_gain, bfp_s32_wiener_gain_dd);
+}
+
+TEST_GROUP(bfp_wiener_gain);
+TEST_SETUP(bfp_wiener_gain) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_wiener_gain) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (257)
+#endif
+
+#define FRAMES      (16)
+
+// Gains are compared as Q2.30 values. Aligning the signal and noise power vectors to a common 
+// exponent costs a few bits of precision in the smaller of the two.
+#define THRESHOLD   (1<<12)
+
+
+static void rand_power_vect(
+    bfp_s32_t* X,
+    const unsigned length,
+    unsigned* seed)
+{
+    X->exp = pseudo_rand_int(seed, -40, -20);
+    headroom_t hr = pseudo_rand_uint(seed, 0, 4);
+
+    for(int i = 0; i < length; i++){
+        X->data[i] = (pseudo_rand_uint32(seed) >> 1) >> hr;
+    }
+
+    bfp_s32_headroom(X);
+}
+
+
+TEST(bfp_wiener_gain, bfp_s32_wiener_gain)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t A_data[MAX_LEN];
+    int32_t S_data[MAX_LEN];
+    int32_t N_data[MAX_LEN];
+
+    double Sf[MAX_LEN];
+    double Nf[MAX_LEN];
+
+    bfp_s32_t A, S, N;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        bfp_s32_init(&A, A_data, 0, length, 0);
+        bfp_s32_init(&S, S_data, 0, length, 0);
+        bfp_s32_init(&N, N_data, 0, length, 0);
+
+        rand_power_vect(&S, length, &seed);
+        rand_power_vect(&N, length, &seed);
+
+        // Keep signal and noise within a few bits of one another so that gains are spread over
+        // the full range
+        N.exp = S.exp + pseudo_rand_int(&seed, -3, 3);
+
+        const int32_t gain_min = pseudo_rand_uint32(&seed) >> 4;
+
+        test_double_from_s32(Sf, &S);
+        test_double_from_s32(Nf, &N);
+
+        bfp_s32_wiener_gain(&A, &S, &N, gain_min);
+
+        TEST_ASSERT_EQUAL(-30, A.exp);
+        TEST_ASSERT_EQUAL(length, A.length);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+        for(int i = 0; i < length; i++){
+            double expected = (Sf[i] > Nf[i])? (Sf[i] - Nf[i]) / Sf[i] : 0.0;
+            expected = MAX(expected, ldexp(gain_min, -30));
+
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(gain_min, A.data[i]);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(0x40000000, A.data[i]);
+            TEST_ASSERT_INT32_WITHIN(THRESHOLD, (int32_t) ldexp(expected, 30), A.data[i]);
+        }
+    }
+}
+
+
+TEST(bfp_wiener_gain, bfp_s32_wiener_gain_dd)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t A_data[MAX_LEN];
+    int32_t P_data[MAX_LEN];
+    int32_t S_data[MAX_LEN];
+    int32_t N_data[MAX_LEN];
+
+    double Pf[MAX_LEN];
+    double Sf[MAX_LEN];
+    double Nf[MAX_LEN];
+    double Pf_act[MAX_LEN];
+
+    bfp_s32_t A, P, S, N;
+
+    for(int r = 0; r < REPS / FRAMES; r++){
+        setExtraInfo_RS(r, seed);
+
+        const unsigned length = pseudo_rand_uint(&seed, 1, MAX_LEN+1);
+
+        const int32_t alpha = 0x40000000 - (pseudo_rand_uint32(&seed) >> 5);
+        const int32_t gain_min = pseudo_rand_uint32(&seed) >> 4;
+        const double alpha_f = ldexp(alpha, -30);
+        const double gain_min_f = ldexp(gain_min, -30);
+
+        bfp_s32_init(&A, A_data, 0, length, 0);
+        bfp_s32_init(&P, P_data, 0, length, 0);
+        bfp_s32_init(&S, S_data, 0, length, 0);
+        bfp_s32_init(&N, N_data, 0, length, 0);
+
+        // Initial clean power estimate is zero
+        bfp_s32_set(&P, 0, 0);
+
+        for(int i = 0; i < length; i++)
+            Pf[i] = 0.0;
+
+        const exponent_t base_exp = pseudo_rand_int(&seed, -40, -20);
+
+        for(int f = 0; f < FRAMES; f++){
+
+            rand_power_vect(&S, length, &seed);
+            rand_power_vect(&N, length, &seed);
+
+            // Signal level doesn't vary too much from frame to frame
+            S.exp = base_exp + pseudo_rand_int(&seed, -2, 2);
+            N.exp = S.exp + pseudo_rand_int(&seed, -3, 3);
+
+            test_double_from_s32(Sf, &S);
+            test_double_from_s32(Nf, &N);
+
+            bfp_s32_wiener_gain_dd(&A, &P, &S, &N, alpha, gain_min);
+
+            TEST_ASSERT_EQUAL(-30, A.exp);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(P.data, P.length), P.hr);
+
+            test_double_from_s32(Pf_act, &P);
+
+            for(int i = 0; i < length; i++){
+                const double snr_ml = MAX(Sf[i] / Nf[i] - 1.0, 0.0);
+                const double xi = alpha_f * Pf[i] / Nf[i] + (1.0 - alpha_f) * snr_ml;
+                const double gain = MAX(xi / (1.0 + xi), gain_min_f);
+
+                Pf[i] = gain * gain * Sf[i];
+
+                TEST_ASSERT_GREATER_OR_EQUAL_INT32(gain_min, A.data[i]);
+                TEST_ASSERT_LESS_OR_EQUAL_INT32(0x40000000, A.data[i]);
+                TEST_ASSERT_INT32_WITHIN(THRESHOLD, (int32_t) ldexp(gain, 30), A.data[i]);
+
+                // Clean power is computed at the common exponent, so a few LSbs of error are 
+                // expected on top of that due to the gain's error
+                TEST_ASSERT_INT32_WITHIN((int32_t) ldexp(Sf[i], -16 - P.exp) + 4, 
+                                         (int32_t) ldexp(Pf[i], -P.exp), P.data[i]);
+
+                // Continue from the actual state so that errors don't compound between frames
+                Pf[i] = Pf_act[i];
+            }
+        }
+    }
+}
@@ -27,6 +27,13 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(bfp_scale);
     RUN_TEST_GROUP(bfp_abs);
     RUN_TEST_GROUP(bfp_clip);
+    RUN_TEST_GROUP(bfp_softclip);
+    RUN_TEST_GROUP(bfp_cumsum);
+    RUN_TEST_GROUP(bfp_delay_and_sum);
+    RUN_TEST_GROUP(bfp_smooth);
+    RUN_TEST_GROUP(bfp_pyramid);
+    RUN_TEST_GROUP(bfp_vad);
+    RUN_TEST_GROUP(bfp_elementwise);
     RUN_TEST_GROUP(bfp_rect);
     RUN_TEST_GROUP(bfp_sum);
     RUN_TEST_GROUP(bfp_dot);
@@ -39,8 +46,13 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(bfp_min);
     RUN_TEST_GROUP(bfp_argmax);
     RUN_TEST_GROUP(bfp_argmin);
+    RUN_TEST_GROUP(bfp_stats);
+    RUN_TEST_GROUP(bfp_variance);
+    RUN_TEST_GROUP(bfp_topk);
+    RUN_TEST_GROUP(bfp_percentile);
     RUN_TEST_GROUP(bfp_inverse);
     RUN_TEST_GROUP(bfp_macc);
+    RUN_TEST_GROUP(bfp_wiener_gain);
 
     RUN_TEST_GROUP(bfp_complex_add);
     RUN_TEST_GROUP(bfp_complex_add_scalar);
@@ -55,13 +67,22 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(bfp_complex_sum);
     RUN_TEST_GROUP(bfp_complex_macc);
     RUN_TEST_GROUP(bfp_complex_conj_macc);
+    RUN_TEST_GROUP(bfp_complex_conj_macc_ema);
+    RUN_TEST_GROUP(bfp_complex_hermitian_solve);
     RUN_TEST_GROUP(bfp_complex_conjugate);
     RUN_TEST_GROUP(bfp_complex_energy);
+    RUN_TEST_GROUP(bfp_complex_apply_gain);
+    RUN_TEST_GROUP(bfp_complex_planar);
     
     RUN_TEST_GROUP(bfp_depth_convert);
     RUN_TEST_GROUP(bfp_complex_depth_convert);
 
     RUN_TEST_GROUP(bfp_gradient_constraint);
+    RUN_TEST_GROUP(bfp_min_stats);
+    RUN_TEST_GROUP(bfp_meter);
+    RUN_TEST_GROUP(bfp_cmvn);
+    RUN_TEST_GROUP(bfp_window);
+    RUN_TEST_GROUP(bfp_compressor);
     RUN_TEST_GROUP(bfp_convolve);
     
     return UNITY_END();
@@ -0,0 +1,133 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_cmvn) {
+  RUN_TEST_CASE(bfp_cmvn, bfp_cmvn_s32_update);
+  RUN_TEST_CASE(bfp_cmvn, bfp_cmvn_s32_update_large_mean);
+}
+TEST_GROUP(bfp_cmvn);
+TEST_SETUP(bfp_cmvn) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_cmvn) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (50)
+#endif
+
+#define MAX_DIMS          (40)
+#define MAX_FRAMES        (60)
+
+
+
+/*
+ * Runs a CMVN state over a stream of frames in which each dimension has a random offset of up to full
+ * scale, with noise noise_shr bits below full scale added to it, and checks each output against a
+ * double-precision implementation. threshold is the permitted error, relative to max(1, |expected|).
+ */
+static void test_cmvn(
+    unsigned* seed,
+    const unsigned noise_shr,
+    const double threshold)
+{
+  int32_t buffer[BFP_CMVN_S32_BUFFER_SIZE(MAX_DIMS)];
+  int32_t A_data[MAX_DIMS];
+  int32_t X_data[MAX_DIMS];
+
+  bfp_cmvn_s32_t cmvn;
+  bfp_s32_t A, X;
+
+  double X_flt[MAX_DIMS];
+  double A_flt[MAX_DIMS];
+  double mean[MAX_DIMS];
+  double var[MAX_DIMS];
+  double dim_offset[MAX_DIMS];
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, *seed);
+
+    const unsigned dims = pseudo_rand_uint(seed, 1, MAX_DIMS+1);
+    const fixed_s32_t alpha_q30 = pseudo_rand_uint(seed, 0x30000000, 0x40000000);
+
+    // The floor is kept well below the variance of the noise
+    const float_s32_t var_floor = { .mant = 0x40000000, .exp = -30 - 10 - 2 * noise_shr };
+
+    const double alpha = ldexp(alpha_q30, -30);
+    const double eps = float_s32_to_double(var_floor);
+
+    bfp_cmvn_s32_init(&cmvn, buffer, dims, alpha_q30, var_floor);
+    bfp_s32_init(&A, A_data, 0, dims, 0);
+    bfp_s32_init(&X, X_data, 0, dims, 0);
+
+    // Each dimension has its own (non-zero) mean
+    for(int k = 0; k < dims; k++)
+      dim_offset[k] = ldexp(pseudo_rand_int32(seed), -31);
+
+    for(int t = 0; t < MAX_FRAMES; t++){
+
+      X.exp = pseudo_rand_int(seed, -32, -28);
+      for(int k = 0; k < dims; k++)
+        X.data[k] = (int32_t) ldexp(dim_offset[k], -X.exp - 2) + (pseudo_rand_int32(seed) >> noise_shr);
+      bfp_s32_headroom(&X);
+
+      test_double_from_s32(X_flt, &X);
+
+      for(int k = 0; k < dims; k++){
+        if(t == 0){
+          mean[k] = X_flt[k];
+          var[k] = 0;
+        } else {
+          const double d = X_flt[k] - mean[k];
+          mean[k] = mean[k] + (1 - alpha) * d;
+          var[k] = alpha * (var[k] + (1 - alpha) * d * d);
+        }
+      }
+
+      // Alternate between out-of-place and in-place
+      bfp_s32_t* out = (t & 1)? &X : &A;
+      bfp_cmvn_s32_update(out, &cmvn, &X);
+
+      test_double_from_s32(A_flt, out);
+
+      for(int k = 0; k < dims; k++){
+        const double expected = (X_flt[k] - mean[k]) / sqrt(var[k] + eps);
+
+        TEST_ASSERT(fabs(A_flt[k] - expected) <= threshold * MAX(1, fabs(expected)));
+      }
+    }
+  }
+}
+
+
+TEST(bfp_cmvn, bfp_cmvn_s32_update)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  test_cmvn(&seed, 4, ldexp(1, -14));
+}
+
+
+TEST(bfp_cmvn, bfp_cmvn_s32_update_large_mean)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  // The spread is about 2^-16 of the mean, so the mean square and squared mean agree in about 
+  // their first 32 bits, and their difference can't be used to estimate the variance. The deviations 
+  // themselves only have about 16 significant bits, which limits the accuracy of the output.
+  test_cmvn(&seed, 16, ldexp(1, -11));
+}
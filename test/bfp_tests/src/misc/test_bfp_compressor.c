@@ -0,0 +1,153 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_compressor) {
+  RUN_TEST_CASE(bfp_compressor, bfp_compressor_s32_update_limiter);
+  RUN_TEST_CASE(bfp_compressor, bfp_compressor_s32_update_static_curve);
+}
+TEST_GROUP(bfp_compressor);
+TEST_SETUP(bfp_compressor) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_compressor) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (100)
+#endif
+
+#define MAX_FRAME_LEN     (64)
+#define FRAMES            (30)
+
+// Relative error threshold for output levels
+#define LEVEL_THRESHOLD   (ldexp(1, -20))
+// Error threshold for steady-state gains, as a base-2 logarithm
+#define GAIN_THRESHOLD    (ldexp(1, -16))
+
+
+TEST(bfp_compressor, bfp_compressor_s32_update_limiter)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t buffer[BFP_COMPRESSOR_S32_BUFFER_SIZE(MAX_FRAME_LEN)];
+  int32_t A_data[MAX_FRAME_LEN];
+  int32_t X_data[MAX_FRAME_LEN];
+
+  double prev_flt[MAX_FRAME_LEN];
+  double X_flt[MAX_FRAME_LEN];
+  double A_flt[MAX_FRAME_LEN];
+
+  bfp_compressor_s32_t comp;
+  bfp_s32_t A, X;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned frame_len = pseudo_rand_uint(&seed, 1, MAX_FRAME_LEN+1);
+    const float_s32_t threshold = { .mant = pseudo_rand_uint(&seed, 0x10000000, 0x40000000), .exp = -32 };
+    const float_s32_t max_gain = { .mant = 0x40000000, .exp = -30 };
+    const fixed_s32_t release = pseudo_rand_uint(&seed, 0x20000000, 0x40000000);
+
+    const double T = float_s32_to_double(threshold);
+
+    bfp_compressor_s32_init(&comp, buffer, frame_len, threshold, 0x40000000, 0, max_gain, 0, release);
+    bfp_s32_init(&A, A_data, 0, frame_len, 0);
+    bfp_s32_init(&X, X_data, 0, frame_len, 0);
+
+    memset(prev_flt, 0, sizeof(prev_flt));
+
+    for(int t = 0; t < FRAMES; t++){
+
+      X.exp = -31;
+      const headroom_t hr = pseudo_rand_uint(&seed, 0, 8);
+      for(int k = 0; k < frame_len; k++)
+        X.data[k] = pseudo_rand_int32(&seed) >> hr;
+      bfp_s32_headroom(&X);
+
+      test_double_from_s32(X_flt, &X);
+
+      // Alternate between out-of-place and in-place
+      bfp_s32_t* out = (t & 1)? &X : &A;
+      bfp_compressor_s32_update(out, &comp, &X);
+
+      TEST_ASSERT_EQUAL(bfp_s32_headroom(out), out->hr);
+      test_double_from_s32(A_flt, out);
+
+      // The output is the previous frame with a gain of at most 1, and never exceeds the threshold.
+      for(int k = 0; k < frame_len; k++){
+        TEST_ASSERT(fabs(A_flt[k]) <= T * (1 + LEVEL_THRESHOLD));
+        TEST_ASSERT(fabs(A_flt[k]) <= fabs(prev_flt[k]) * (1 + LEVEL_THRESHOLD));
+        TEST_ASSERT(A_flt[k] * prev_flt[k] >= 0);
+      }
+
+      memcpy(prev_flt, X_flt, sizeof(X_flt));
+    }
+  }
+}
+
+
+TEST(bfp_compressor, bfp_compressor_s32_update_static_curve)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t buffer[BFP_COMPRESSOR_S32_BUFFER_SIZE(MAX_FRAME_LEN)];
+  int32_t A_data[MAX_FRAME_LEN];
+  int32_t X_data[MAX_FRAME_LEN];
+
+  bfp_compressor_s32_t comp;
+  bfp_s32_t A, X;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned frame_len = pseudo_rand_uint(&seed, 1, MAX_FRAME_LEN+1);
+    const float_s32_t threshold = { .mant = pseudo_rand_uint(&seed, 0x10000000, 0x40000000), .exp = -34 };
+    const float_s32_t max_gain = { .mant = pseudo_rand_uint(&seed, 0x10000000, 0x40000000), .exp = -28 };
+    const fixed_s32_t slope_above = pseudo_rand_uint(&seed, 0, 0x40000001);
+    const fixed_s32_t slope_below = (r & 1)? 0 : pseudo_rand_uint(&seed, 0, 0x40000001);
+
+    bfp_compressor_s32_init(&comp, buffer, frame_len, threshold, slope_above, slope_below, 
+                            max_gain, 0, 0);
+    bfp_s32_init(&A, A_data, 0, frame_len, 0);
+    bfp_s32_init(&X, X_data, -31, frame_len, 0);
+
+    // Frames all with the same peak level, well above or below the threshold
+    const int32_t P = pseudo_rand_uint(&seed, 0x00100000, 0x7FFFFFFF);
+    const double level = ldexp(P, -31);
+    const double T = float_s32_to_double(threshold);
+    const double G = float_s32_to_double(max_gain);
+
+    const double d = log2(T) - log2(level);
+    const double expected_gain = MIN(d * ldexp((d < 0)? slope_above : slope_below, -30), log2(G));
+
+    for(int t = 0; t < 3; t++){
+      for(int k = 0; k < frame_len; k++)
+        X.data[k] = pseudo_rand_int32(&seed) % P;
+      X.data[pseudo_rand_uint(&seed, 0, frame_len)] = (pseudo_rand_uint32(&seed) & 1)? P : -P;
+      bfp_s32_headroom(&X);
+
+      bfp_compressor_s32_update(&A, &comp, &X);
+    }
+
+    // By now the gain has settled, so the peak of the output is the input peak with the static
+    // gain curve applied.
+    const double out_peak = MAX(fabs(float_s32_to_double(bfp_s32_max(&A))), 
+                                fabs(float_s32_to_double(bfp_s32_min(&A))));
+
+    TEST_ASSERT(fabs(log2(out_peak / level) - expected_gain) <= GAIN_THRESHOLD);
+  }
+}
@@ -77,7 +77,7 @@ TEST(bfp_gradient_constraint, bfp_complex_s32_gradient_constraint_mono)
       // It's possible doing the IFFT allowed noise to bleed into the samples that should be zero
       // here, so give some slack
 
-      XTEST_ASSERT_VECT_S32_WITHIN(20, expected, A_td->data, A_td->length, 
+      XTEST_ASSERT_VECT_S32_WITHIN(24, expected, A_td->data, A_td->length, 
         "FFT_N: %u\n"
         "frame_advance: %u\n", FFT_N, frame_advance);
 
@@ -0,0 +1,183 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_meter) {
+  RUN_TEST_CASE(bfp_meter, bfp_meter_s32_update);
+  RUN_TEST_CASE(bfp_meter, bfp_meter_s32_update_silence);
+}
+TEST_GROUP(bfp_meter);
+TEST_SETUP(bfp_meter) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_meter) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (50)
+#endif
+
+#define MAX_CHANNELS      (8)
+#define MAX_FRAME_LEN     (48)
+#define MAX_FRAMES        (60)
+
+// Relative error thresholds
+#define PEAK_THRESHOLD    (ldexp(1, -24))
+#define RMS_THRESHOLD     (ldexp(1, -16))
+
+
+TEST(bfp_meter, bfp_meter_s32_update)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t frame_data[MAX_CHANNELS][MAX_FRAME_LEN];
+  bfp_s32_t frame[MAX_CHANNELS];
+
+  bfp_meter_s32_channel_t state[MAX_CHANNELS];
+  bfp_meter_s32_t meter;
+
+  double frame_flt[MAX_FRAME_LEN];
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned channels = pseudo_rand_uint(&seed, 1, MAX_CHANNELS+1);
+    const unsigned frame_len = pseudo_rand_uint(&seed, 1, MAX_FRAME_LEN+1);
+    const unsigned hold_frames = pseudo_rand_uint(&seed, 0, 6);
+    const fixed_s32_t peak_decay = pseudo_rand_uint(&seed, 0x30000000, 0x40000000);
+    const fixed_s32_t rms_coef = pseudo_rand_uint(&seed, 0x20000000, 0x40000000);
+
+    const double d = ldexp(peak_decay, -30);
+    const double alpha = ldexp(rms_coef, -30);
+
+    double exp_peak[MAX_CHANNELS] = {0};
+    double exp_ms[MAX_CHANNELS] = {0};
+    unsigned exp_hold[MAX_CHANNELS] = {0};
+
+    bfp_meter_s32_init(&meter, state, channels, frame_len, hold_frames, peak_decay, rms_coef);
+
+    for(int c = 0; c < channels; c++)
+      bfp_s32_init(&frame[c], frame_data[c], 0, frame_len, 0);
+
+    for(int t = 0; t < MAX_FRAMES; t++){
+
+      for(int c = 0; c < channels; c++){
+        // Levels vary widely between channels and frames
+        frame[c].exp = pseudo_rand_int(&seed, -40, -20);
+        const headroom_t hr = pseudo_rand_uint(&seed, 0, 12);
+
+        for(int k = 0; k < frame_len; k++)
+          frame[c].data[k] = pseudo_rand_int32(&seed) >> hr;
+
+        bfp_s32_headroom(&frame[c]);
+
+        test_double_from_s32(frame_flt, &frame[c]);
+
+        double peak = 0;
+        double ms = 0;
+        for(int k = 0; k < frame_len; k++){
+          peak = MAX(peak, fabs(frame_flt[k]));
+          ms += frame_flt[k] * frame_flt[k];
+        }
+        ms /= frame_len;
+
+        if(exp_hold[c])   exp_hold[c]--;
+        else              exp_peak[c] *= d;
+
+        if(peak >= exp_peak[c]){
+          exp_peak[c] = peak;
+          exp_hold[c] = hold_frames;
+        }
+
+        exp_ms[c] = alpha * exp_ms[c] + (1 - alpha) * ms;
+      }
+
+      bfp_meter_s32_update(&meter, frame);
+
+      for(int c = 0; c < channels; c++){
+        const double peak = float_s32_to_double(bfp_meter_s32_peak(&meter, c));
+        const double rms = float_s32_to_double(bfp_meter_s32_rms(&meter, c));
+        const double exp_rms = sqrt(exp_ms[c]);
+
+        TEST_ASSERT(fabs(peak - exp_peak[c]) <= PEAK_THRESHOLD * exp_peak[c]);
+        TEST_ASSERT(fabs(rms - exp_rms) <= RMS_THRESHOLD * exp_rms);
+      }
+    }
+  }
+}
+
+
+TEST(bfp_meter, bfp_meter_s32_update_silence)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t frame_data[MAX_CHANNELS][MAX_FRAME_LEN];
+  bfp_s32_t frame[MAX_CHANNELS];
+
+  bfp_meter_s32_channel_t state[MAX_CHANNELS];
+  bfp_meter_s32_t meter;
+
+  const unsigned channels = MAX_CHANNELS;
+  const unsigned frame_len = MAX_FRAME_LEN;
+  const unsigned hold_frames = 3;
+
+  bfp_meter_s32_init(&meter, state, channels, frame_len, hold_frames, 0x3C000000, 0x38000000);
+
+  for(int c = 0; c < channels; c++){
+    bfp_s32_init(&frame[c], frame_data[c], -31, frame_len, 0);
+    memset(frame_data[c], 0, sizeof(frame_data[c]));
+    bfp_s32_headroom(&frame[c]);
+  }
+
+  // Silence at the start leaves all levels at zero, with exponents that don't run away
+  for(int t = 0; t < 1000; t++)
+    bfp_meter_s32_update(&meter, frame);
+
+  for(int c = 0; c < channels; c++){
+    TEST_ASSERT_EQUAL_INT32(0, bfp_meter_s32_peak(&meter, c).mant);
+    TEST_ASSERT_EQUAL_INT32(0, bfp_meter_s32_rms(&meter, c).mant);
+    TEST_ASSERT_INT32_WITHIN(100, 0, state[c].peak.exp);
+    TEST_ASSERT_INT32_WITHIN(100, 0, state[c].mean_square.exp);
+  }
+
+  // A single non-silent frame is held for hold_frames frames of silence, then decays
+  for(int k = 0; k < frame_len; k++)
+    frame_data[1][k] = pseudo_rand_int32(&seed) >> 4;
+  bfp_s32_headroom(&frame[1]);
+
+  const float_s32_t peak = bfp_s32_max(&frame[1]).mant >= -bfp_s32_min(&frame[1]).mant?
+                              bfp_s32_max(&frame[1]) : float_s32_abs(bfp_s32_min(&frame[1]));
+
+  bfp_meter_s32_update(&meter, frame);
+  TEST_ASSERT_EQUAL_INT32(peak.mant, bfp_meter_s32_peak(&meter, 1).mant);
+  TEST_ASSERT_EQUAL_INT32(peak.exp, bfp_meter_s32_peak(&meter, 1).exp);
+
+  memset(frame_data[1], 0, sizeof(frame_data[1]));
+  bfp_s32_headroom(&frame[1]);
+
+  for(int t = 0; t < hold_frames; t++){
+    bfp_meter_s32_update(&meter, frame);
+    TEST_ASSERT_EQUAL_INT32(peak.mant, bfp_meter_s32_peak(&meter, 1).mant);
+    TEST_ASSERT_EQUAL_INT32(peak.exp, bfp_meter_s32_peak(&meter, 1).exp);
+  }
+
+  bfp_meter_s32_update(&meter, frame);
+  TEST_ASSERT(float_s32_gt(peak, bfp_meter_s32_peak(&meter, 1)));
+
+  // Other channels were unaffected
+  TEST_ASSERT_EQUAL_INT32(0, bfp_meter_s32_peak(&meter, 0).mant);
+  TEST_ASSERT_EQUAL_INT32(0, bfp_meter_s32_peak(&meter, 2).mant);
+}
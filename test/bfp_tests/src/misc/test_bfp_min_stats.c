@@ -0,0 +1,142 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_min_stats) {
+  RUN_TEST_CASE(bfp_min_stats, bfp_min_stats_s32_update);
+  RUN_TEST_CASE(bfp_min_stats, bfp_min_stats_s32_update_silence);
+}
+TEST_GROUP(bfp_min_stats);
+TEST_SETUP(bfp_min_stats) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_min_stats) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (50)
+#endif
+
+#define MAX_BINS          (65)
+#define MAX_SUBWIN_COUNT  (8)
+#define MAX_SUBWIN_FRAMES (6)
+#define MAX_FRAMES        (4 * MAX_SUBWIN_COUNT * MAX_SUBWIN_FRAMES)
+
+
+TEST(bfp_min_stats, bfp_min_stats_s32_update)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t buffer[BFP_MIN_STATS_S32_BUFFER_SIZE(MAX_BINS, MAX_SUBWIN_COUNT)];
+  bfp_s32_t subwin_min[MAX_SUBWIN_COUNT];
+  bfp_min_stats_s32_t tracker;
+
+  int32_t P_data[MAX_BINS];
+  int32_t A_data[MAX_BINS];
+  bfp_s32_t P, A;
+
+  static double history[MAX_FRAMES][MAX_BINS];
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned bins = pseudo_rand_uint(&seed, 1, MAX_BINS+1);
+    const unsigned U = pseudo_rand_uint(&seed, 2, MAX_SUBWIN_COUNT+1);
+    const unsigned V = pseudo_rand_uint(&seed, 1, MAX_SUBWIN_FRAMES+1);
+    const unsigned frames = pseudo_rand_uint(&seed, 1, MAX_FRAMES+1);
+
+    bfp_min_stats_s32_init(&tracker, subwin_min, buffer, bins, U, V);
+
+    bfp_s32_init(&P, P_data, 0, bins, 0);
+    bfp_s32_init(&A, A_data, 0, bins, 0);
+
+    for(int t = 0; t < frames; t++){
+
+      P.exp = pseudo_rand_int(&seed, -35, -25);
+      const headroom_t hr = pseudo_rand_uint(&seed, 0, 8);
+
+      for(int k = 0; k < bins; k++)
+        P.data[k] = (pseudo_rand_uint32(&seed) >> 1) >> hr;
+
+      bfp_s32_headroom(&P);
+
+      test_double_from_s32(history[t], &P);
+
+      bfp_min_stats_s32_update(&A, &tracker, &P);
+
+      TEST_ASSERT_EQUAL(bins, A.length);
+      TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A.data, A.length), A.hr);
+
+      // Window begins at the start of the oldest sub-window still being tracked
+      const int cur_subwin = t / V;
+      const int first_subwin = MAX(0, cur_subwin - ((int)U - 1));
+      const int first_frame = first_subwin * V;
+
+      for(int k = 0; k < bins; k++){
+        double expected = history[first_frame][k];
+        for(int i = first_frame + 1; i <= t; i++)
+          expected = MIN(expected, history[i][k]);
+
+        // Only left-shifts are ever applied to mantissas, so the result should be exact.
+        TEST_ASSERT_EQUAL_INT32((int32_t) ldexp(expected, -A.exp), A.data[k]);
+      }
+    }
+  }
+}
+
+
+TEST(bfp_min_stats, bfp_min_stats_s32_update_silence)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  const unsigned bins = 40;
+  const unsigned U = 4;
+  const unsigned V = 3;
+
+  int32_t buffer[BFP_MIN_STATS_S32_BUFFER_SIZE(40, 4)];
+  bfp_s32_t subwin_min[4];
+  bfp_min_stats_s32_t tracker;
+
+  int32_t P_data[40];
+  int32_t A_data[40];
+  bfp_s32_t P, A;
+
+  bfp_min_stats_s32_init(&tracker, subwin_min, buffer, bins, U, V);
+  bfp_s32_init(&P, P_data, 0, bins, 0);
+  bfp_s32_init(&A, A_data, 0, bins, 0);
+
+  // A long run of silent frames followed by signal. The tracker's exponents shouldn't drift
+  // during the silence, and once the silent frames have left the window the floor follows the
+  // signal again.
+  for(int t = 0; t < 1000; t++){
+    bfp_s32_set(&P, 0, -30);
+    bfp_min_stats_s32_update(&A, &tracker, &P);
+  }
+
+  TEST_ASSERT_GREATER_THAN_INT32(-100, A.exp);
+
+  for(int t = 0; t < U * V; t++){
+    P.exp = -30;
+    for(int k = 0; k < bins; k++)
+      P.data[k] = 0x10000 + (pseudo_rand_uint32(&seed) >> 8);
+    bfp_s32_headroom(&P);
+
+    bfp_min_stats_s32_update(&A, &tracker, &P);
+  }
+
+  for(int k = 0; k < bins; k++)
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32((int32_t) ldexp(0x10000, -30 - A.exp), A.data[k]);
+}
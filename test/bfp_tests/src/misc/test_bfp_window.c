@@ -0,0 +1,123 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "bfp_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_window) {
+  RUN_TEST_CASE(bfp_window, bfp_window_s32_push);
+}
+TEST_GROUP(bfp_window);
+TEST_SETUP(bfp_window) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_window) {}
+
+
+#if SMOKE_TEST
+#  define REPS       (10)
+#else
+#  define REPS       (100)
+#endif
+
+#define MAX_WINDOW        (100)
+#define MAX_BLOCK_LEN     (150)
+#define BLOCKS            (40)
+
+// Relative error threshold for the mean
+#define MEAN_THRESHOLD    (ldexp(1, -28))
+
+
+TEST(bfp_window, bfp_window_s32_push)
+{
+  unsigned seed = SEED_FROM_FUNC_NAME();
+
+  int32_t buffer[BFP_WINDOW_S32_BUFFER_SIZE(MAX_WINDOW)];
+  int32_t block_data[MAX_BLOCK_LEN];
+  int32_t stream[BLOCKS * MAX_BLOCK_LEN];
+
+  bfp_window_s32_t win;
+  bfp_s32_t block;
+
+  for(int r = 0; r < REPS; r++){
+    setExtraInfo_RS(r, seed);
+
+    const unsigned W = pseudo_rand_uint(&seed, 1, MAX_WINDOW+1);
+    const exponent_t win_exp = pseudo_rand_int(&seed, -40, 0);
+    const headroom_t hr = pseudo_rand_uint(&seed, 0, 20);
+
+    bfp_window_s32_init(&win, buffer, W, win_exp);
+
+    unsigned count = 0;
+
+    for(int t = 0; t < BLOCKS; t++){
+      // Blocks of any length (including longer than the window and empty) and with exponents 
+      // either side of the window's. Mantissas are chosen so the samples are exactly representable
+      // at the window's exponent.
+      const unsigned len = pseudo_rand_uint(&seed, 0, MAX_BLOCK_LEN+1);
+      const int shift = pseudo_rand_int(&seed, -3, 4);
+
+      bfp_s32_init(&block, block_data, win_exp - shift, len, 0);
+
+      for(int k = 0; k < len; k++){
+        // Sometimes runs of repeated values, to exercise ties in the max/min deques
+        if(k > 0 && (pseudo_rand_uint32(&seed) % 4 == 0)){
+          block.data[k] = block.data[k-1];
+          stream[count] = stream[count-1];
+          count++;
+          continue;
+        }
+
+        const int32_t s = pseudo_rand_int32(&seed) >> (hr + abs(shift));
+        block.data[k] = (shift >= 0)? s * (1 << shift) : s;
+        stream[count++] = (shift >= 0)? s : s * (1 << -shift);
+      }
+
+      bfp_window_s32_push(&win, &block);
+
+      if(count == 0)
+        continue;
+
+      const unsigned first = (count > W)? count - W : 0;
+      const unsigned n = count - first;
+
+      int64_t exp_sum = 0;
+      int64_t exp_energy = 0;
+      int32_t exp_max = stream[first];
+      int32_t exp_min = stream[first];
+
+      for(int k = first; k < count; k++){
+        exp_sum += stream[k];
+        exp_energy += (((int64_t)stream[k]) * stream[k]) >> win.energy_shr;
+        exp_max = MAX(exp_max, stream[k]);
+        exp_min = MIN(exp_min, stream[k]);
+      }
+
+      const float_s64_t sum = bfp_window_s32_sum(&win);
+      const float_s64_t energy = bfp_window_s32_energy(&win);
+      const float_s32_t max = bfp_window_s32_max(&win);
+      const float_s32_t min = bfp_window_s32_min(&win);
+      const double mean = float_s32_to_double(bfp_window_s32_mean(&win));
+      const double exp_mean = ldexp((double) exp_sum, win_exp) / n;
+
+      TEST_ASSERT_EQUAL_INT64(exp_sum, sum.mant);
+      TEST_ASSERT_EQUAL_INT32(win_exp, sum.exp);
+      TEST_ASSERT_EQUAL_INT64(exp_energy, energy.mant);
+      TEST_ASSERT_EQUAL_INT32(2 * win_exp + win.energy_shr, energy.exp);
+      TEST_ASSERT_EQUAL_INT32(exp_max, max.mant);
+      TEST_ASSERT_EQUAL_INT32(win_exp, max.exp);
+      TEST_ASSERT_EQUAL_INT32(exp_min, min.mant);
+      TEST_ASSERT_EQUAL_INT32(win_exp, min.exp);
+      TEST_ASSERT(fabs(mean - exp_mean) <= MEAN_THRESHOLD * fabs(exp_mean) + ldexp(1, win_exp - 30));
+    }
+  }
+}
@@ -27,6 +27,7 @@ int main(int argc, const char* argv[])
 
     RUN_TEST_GROUP(bfp_fft);
     RUN_TEST_GROUP(bfp_fft_packing);
+    RUN_TEST_GROUP(bfp_hilbert);
 
 #if WRITE_PERFORMANCE_INFO
     fclose(perf_file);
@@ -15,6 +15,8 @@ TEST_GROUP_RUNNER(bfp_fft) {
   RUN_TEST_CASE(bfp_fft, bfp_fft_inverse_complex);
   RUN_TEST_CASE(bfp_fft, bfp_fft_forward_stereo);
   RUN_TEST_CASE(bfp_fft, bfp_fft_inverse_stereo);
+  RUN_TEST_CASE(bfp_fft, bfp_fft_stereo_in_place);
+  RUN_TEST_CASE(bfp_fft, bfp_fft_multi);
   RUN_TEST_CASE(bfp_fft, bfp_fft_forward_mono);
   RUN_TEST_CASE(bfp_fft, bfp_fft_inverse_mono);
 }
@@ -433,6 +435,129 @@ TEST(bfp_fft, bfp_fft_inverse_stereo)
 }
 
 
+TEST(bfp_fft, bfp_fft_stereo_in_place)
+{
+    unsigned r = 1;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+        unsigned FFT_N = (1<<k);
+
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            // Adjacent channel buffers (no scratch needed)
+            int32_t DWORD_ALIGNED adjacent[2*MAX_PROC_FRAME_LENGTH];
+            // Channel buffers with a gap between them (scratch needed)
+            int32_t DWORD_ALIGNED apart[2*MAX_PROC_FRAME_LENGTH + 2];
+            complex_s32_t DWORD_ALIGNED scratch[MAX_PROC_FRAME_LENGTH];
+
+            exponent_t exponentA = pseudo_rand_int(&r, EXP_BOUND_LOW, EXP_BOUND_HIGH);
+            exponent_t exponentB = pseudo_rand_int(&r, EXP_BOUND_LOW, EXP_BOUND_HIGH);
+            right_shift_t a_shr = pseudo_rand_uint(&r, 0, MAX_HEADROOM+1);
+            right_shift_t b_shr = pseudo_rand_uint(&r, 0, MAX_HEADROOM+1);
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                adjacent[i] = apart[i] = pseudo_rand_int32(&r) >> a_shr;
+                adjacent[FFT_N + i] = apart[FFT_N + 2 + i] = pseudo_rand_int32(&r) >> b_shr;
+            }
+
+            bfp_s32_t chanA, chanB, refA, refB;
+            bfp_s32_init(&chanA, &adjacent[0], exponentA, FFT_N, 1);
+            bfp_s32_init(&chanB, &adjacent[FFT_N], exponentB, FFT_N, 1);
+            bfp_s32_init(&refA, &apart[0], exponentA, FFT_N, 1);
+            bfp_s32_init(&refB, &apart[FFT_N + 2], exponentB, FFT_N, 1);
+
+            // The in-place transform must give exactly the same result as the out-of-place one
+            bfp_fft_forward_stereo(&chanA, &chanB, NULL);
+            bfp_fft_forward_stereo(&refA, &refB, scratch);
+
+            TEST_ASSERT_EQUAL(refA.exp, chanA.exp);
+            TEST_ASSERT_EQUAL(refB.exp, chanB.exp);
+            TEST_ASSERT_EQUAL(refA.hr, chanA.hr);
+            TEST_ASSERT_EQUAL(refA.length, chanA.length);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(refA.data, chanA.data, FFT_N);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(refB.data, chanB.data, FFT_N);
+
+            bfp_fft_inverse_stereo((bfp_complex_s32_t*) &chanA, (bfp_complex_s32_t*) &chanB, NULL);
+            bfp_fft_inverse_stereo((bfp_complex_s32_t*) &refA, (bfp_complex_s32_t*) &refB, scratch);
+
+            TEST_ASSERT_EQUAL(refA.exp, chanA.exp);
+            TEST_ASSERT_EQUAL(refB.exp, chanB.exp);
+            TEST_ASSERT_EQUAL(refA.hr, chanA.hr);
+            TEST_ASSERT_EQUAL(FFT_N, chanA.length);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(refA.data, chanA.data, FFT_N);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(refB.data, chanB.data, FFT_N);
+        }
+    }
+}
+
+
+#define MULTI_MAX_CHANNELS  (5)
+#define MULTI_MAX_N_LOG2    (8)
+
+TEST(bfp_fft, bfp_fft_multi)
+{
+    unsigned r = 1;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MULTI_MAX_N_LOG2; k++){
+        unsigned FFT_N = (1<<k);
+
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            const unsigned channel_count = pseudo_rand_uint(&r, 1, MULTI_MAX_CHANNELS+1);
+
+            // Channels back-to-back in one buffer (no scratch needed)
+            int32_t DWORD_ALIGNED buff[MULTI_MAX_CHANNELS << MULTI_MAX_N_LOG2];
+            // Reference channels, each in its own buffer
+            int32_t DWORD_ALIGNED ref_buff[MULTI_MAX_CHANNELS][1 << MULTI_MAX_N_LOG2];
+            complex_s32_t DWORD_ALIGNED scratch[1 << MULTI_MAX_N_LOG2];
+
+            bfp_s32_t chan[MULTI_MAX_CHANNELS];
+            bfp_s32_t ref[MULTI_MAX_CHANNELS];
+
+            for(int c = 0; c < channel_count; c++){
+                const exponent_t exponent = pseudo_rand_int(&r, EXP_BOUND_LOW, EXP_BOUND_HIGH);
+                const right_shift_t shr = pseudo_rand_uint(&r, 0, MAX_HEADROOM+1);
+
+                for(unsigned i = 0; i < FFT_N; i++)
+                    buff[c * FFT_N + i] = ref_buff[c][i] = pseudo_rand_int32(&r) >> shr;
+
+                bfp_s32_init(&chan[c], &buff[c * FFT_N], exponent, FFT_N, 1);
+                bfp_s32_init(&ref[c], ref_buff[c], exponent, FFT_N, 1);
+            }
+
+            // Contiguous channels don't need scratch, but passing it anyway should make no difference
+            bfp_fft_forward_multi(chan, channel_count, (t & 1)? scratch : NULL);
+
+            for(int c = 0; c + 1 < channel_count; c += 2)
+                bfp_fft_forward_stereo(&ref[c], &ref[c+1], scratch);
+            if(channel_count & 1)
+                bfp_fft_forward_mono(&ref[channel_count-1]);
+
+            for(int c = 0; c < channel_count; c++){
+                TEST_ASSERT_EQUAL(FFT_N/2, chan[c].length);
+                TEST_ASSERT_EQUAL(ref[c].exp, chan[c].exp);
+                TEST_ASSERT_EQUAL(ref[c].hr, chan[c].hr);
+                TEST_ASSERT_EQUAL_INT32_ARRAY(ref[c].data, chan[c].data, FFT_N);
+            }
+
+            bfp_fft_inverse_multi((bfp_complex_s32_t*) chan, channel_count, NULL);
+
+            for(int c = 0; c + 1 < channel_count; c += 2)
+                bfp_fft_inverse_stereo((bfp_complex_s32_t*) &ref[c], (bfp_complex_s32_t*) &ref[c+1], scratch);
+            if(channel_count & 1)
+                bfp_fft_inverse_mono((bfp_complex_s32_t*) &ref[channel_count-1]);
+
+            for(int c = 0; c < channel_count; c++){
+                TEST_ASSERT_EQUAL(FFT_N, chan[c].length);
+                TEST_ASSERT_EQUAL(ref[c].exp, chan[c].exp);
+                TEST_ASSERT_EQUAL(ref[c].hr, chan[c].hr);
+                TEST_ASSERT_EQUAL_INT32_ARRAY(ref[c].data, chan[c].data, FFT_N);
+            }
+        }
+    }
+}
+
+
 TEST(bfp_fft, bfp_fft_forward_mono)
 {
 #define FUNC_NAME "bfp_fft_forward_mono"
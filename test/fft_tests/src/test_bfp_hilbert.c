@@ -0,0 +1,253 @@
+// Copyright 2020-2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+
+#include <math.h>
+
+#include "bfp_math.h"
+#include "testing.h"
+#include "floating_fft.h"
+#include "tst_common.h"
+#include "fft.h"
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(bfp_hilbert) {
+  RUN_TEST_CASE(bfp_hilbert, bfp_s32_hilbert);
+  RUN_TEST_CASE(bfp_hilbert, bfp_s32_hilbert_in_place);
+  RUN_TEST_CASE(bfp_hilbert, bfp_s32_envelope);
+}
+
+TEST_GROUP(bfp_hilbert);
+TEST_SETUP(bfp_hilbert) { fflush(stdout); }
+TEST_TEAR_DOWN(bfp_hilbert) {}
+
+
+#define MAX_PROC_FRAME_LENGTH_LOG2 10
+#define MAX_PROC_FRAME_LENGTH (1<<MAX_PROC_FRAME_LENGTH_LOG2)
+
+#define EXPONENT_SIZE   3
+#define MAX_HEADROOM    5
+#define WIGGLE          20
+
+// The analytic signal computed inside bfp_s32_envelope() may carry up to 3 bits of headroom, which
+// the magnitude computation removes, scaling up the error (in LSbs) accordingly.
+#define MAG_HR_SHL      3
+
+#define MIN_FFT_N_LOG2  (4)
+
+#if SMOKE_TEST
+#  define LOOPS_LOG2  (3)
+#else
+#  define LOOPS_LOG2  (6)
+#endif
+
+
+// Compute the analytic signal of the (real parts of the) FFT_N-element sequence in pts[]
+static void flt_analytic_signal_double(
+    complex_double_t pts[],
+    const unsigned FFT_N,
+    const double sine_table[])
+{
+    flt_bit_reverse_indexes_double(pts, FFT_N);
+    flt_fft_forward_double(pts, FFT_N, sine_table);
+
+    for(unsigned f = 1; f < FFT_N/2; f++){
+        pts[f].re *= 2;
+        pts[f].im *= 2;
+        pts[FFT_N/2 + f].re = 0;
+        pts[FFT_N/2 + f].im = 0;
+    }
+
+    flt_bit_reverse_indexes_double(pts, FFT_N);
+    flt_fft_inverse_double(pts, FFT_N, sine_table);
+}
+
+
+TEST(bfp_hilbert, bfp_s32_hilbert)
+{
+#define FUNC_NAME "bfp_s32_hilbert"
+
+#if PRINT_FUNC_NAMES
+    printf("\n%s..\n", FUNC_NAME);
+#endif
+
+    unsigned r = 0x7F3C1A45;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            int32_t DWORD_ALIGNED b[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            bfp_s32_t B;
+            bfp_complex_s32_t A;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                b[i] = pseudo_rand_int32(&r) >> shr;
+
+                ref[i].re = conv_s32_to_double(b[i], initial_exponent, &error);
+                ref[i].im = 0;
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_s32_init(&B, b, initial_exponent, FFT_N, 1);
+            bfp_complex_s32_init(&A, a, 0, 0, 0);
+
+            flt_analytic_signal_double(ref, FFT_N, sine_table);
+
+            bfp_s32_hilbert(&A, &B);
+
+            // Input must not have been modified
+            TEST_ASSERT_EQUAL(FFT_N, B.length);
+            TEST_ASSERT_EQUAL(initial_exponent, B.exp);
+
+            TEST_ASSERT_EQUAL(FFT_N, A.length);
+            TEST_ASSERT_EQUAL(xs3_vect_complex_s32_headroom(A.data, A.length), A.hr);
+
+            unsigned diff = abs_diff_vect_complex_s32(A.data, A.exp, ref, FFT_N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", FUNC_NAME, FFT_N, worst_error);
+#endif
+    }
+
+#undef FUNC_NAME
+}
+
+
+TEST(bfp_hilbert, bfp_s32_hilbert_in_place)
+{
+    unsigned r = 0x1256FA03;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned FFT_N = (1<<k);
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            int32_t* b = (int32_t*) a;
+
+            bfp_s32_t B;
+            bfp_complex_s32_t A;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                b[i] = pseudo_rand_int32(&r) >> shr;
+
+                ref[i].re = conv_s32_to_double(b[i], initial_exponent, &error);
+                ref[i].im = 0;
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_s32_init(&B, b, initial_exponent, FFT_N, 1);
+            bfp_complex_s32_init(&A, a, 0, 0, 0);
+
+            flt_analytic_signal_double(ref, FFT_N, sine_table);
+
+            bfp_s32_hilbert(&A, &B);
+
+            TEST_ASSERT_EQUAL(FFT_N, A.length);
+
+            unsigned diff = abs_diff_vect_complex_s32(A.data, A.exp, ref, FFT_N, &error);
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(k+WIGGLE, diff, "Output delta is too large");
+        }
+    }
+}
+
+
+TEST(bfp_hilbert, bfp_s32_envelope)
+{
+#define FUNC_NAME "bfp_s32_envelope"
+
+#if PRINT_FUNC_NAMES
+    printf("\n%s..\n", FUNC_NAME);
+#endif
+
+    unsigned r = 0x9A4412C7;
+
+    for(unsigned k = MIN_FFT_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned FFT_N = (1<<k);
+        unsigned worst_error = 0;
+
+        double sine_table[(MAX_PROC_FRAME_LENGTH/2) + 1];
+
+        flt_make_sine_table_double(sine_table, FFT_N);
+
+        for(unsigned t = 0; t < (1<<LOOPS_LOG2); t++){
+
+            int32_t DWORD_ALIGNED b[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED scratch[MAX_PROC_FRAME_LENGTH];
+            complex_double_t DWORD_ALIGNED ref_analytic[MAX_PROC_FRAME_LENGTH];
+            double ref[MAX_PROC_FRAME_LENGTH];
+
+            bfp_s32_t B;
+
+            conv_error_e error = 0;
+            const exponent_t initial_exponent = sext(pseudo_rand_int32(&r), EXPONENT_SIZE);
+            right_shift_t shr = pseudo_rand_uint32(&r) % MAX_HEADROOM;
+
+            for(unsigned i = 0; i < FFT_N; i++){
+                b[i] = pseudo_rand_int32(&r) >> shr;
+
+                ref_analytic[i].re = conv_s32_to_double(b[i], initial_exponent, &error);
+                ref_analytic[i].im = 0;
+            }
+            TEST_ASSERT_CONVERSION(error);
+
+            bfp_s32_init(&B, b, initial_exponent, FFT_N, 1);
+
+            flt_analytic_signal_double(ref_analytic, FFT_N, sine_table);
+
+            for(unsigned i = 0; i < FFT_N; i++)
+                ref[i] = sqrt(ref_analytic[i].re * ref_analytic[i].re
+                            + ref_analytic[i].im * ref_analytic[i].im);
+
+            // In-place
+            bfp_s32_envelope(&B, &B, scratch);
+
+            TEST_ASSERT_EQUAL(FFT_N, B.length);
+            TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(B.data, B.length), B.hr);
+
+            unsigned diff = abs_diff_vect_s32(B.data, B.exp, ref, FFT_N, &error);
+            if(diff > worst_error) worst_error = diff;
+            TEST_ASSERT_CONVERSION(error);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE((k+WIGGLE) << MAG_HR_SHL, diff, "Output delta is too large");
+        }
+
+#if PRINT_ERRORS
+        printf("    %s worst error (%u-point): %u\n", FUNC_NAME, FFT_N, worst_error);
+#endif
+    }
+
+#undef FUNC_NAME
+}
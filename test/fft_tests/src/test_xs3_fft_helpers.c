@@ -14,6 +14,8 @@
 
 TEST_GROUP_RUNNER(xs3_fft_helpers) {
   RUN_TEST_CASE(xs3_fft_helpers, xs3_fft_index_bit_reversal);
+  RUN_TEST_CASE(xs3_fft_helpers, xs3_fft_zip_bit_reversal);
+  RUN_TEST_CASE(xs3_fft_helpers, xs3_fft_unzip_bit_reversal);
   RUN_TEST_CASE(xs3_fft_helpers, xs3_vect_complex_s32_tail_reverse);
   RUN_TEST_CASE(xs3_fft_helpers, xs3_fft_spectra_split);
   RUN_TEST_CASE(xs3_fft_helpers, xs3_fft_spectra_merge);
@@ -90,6 +92,80 @@ TEST(xs3_fft_helpers, xs3_fft_index_bit_reversal)
 }
 
 
+TEST(xs3_fft_helpers, xs3_fft_zip_bit_reversal)
+{
+    unsigned r = 1;
+
+    for(unsigned k = MIN_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned N = (1<<k);
+        
+        for(unsigned t = 0; t <= (1<<LOOPS_LOG2); t++){
+
+            // Channels b and c are adjacent in buff, so that buff can also be zipped in-place
+            int32_t DWORD_ALIGNED buff[2*MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED ref[MAX_PROC_FRAME_LENGTH];
+
+            int32_t* b = &buff[0];
+            int32_t* c = &buff[N];
+
+            const right_shift_t b_shr = pseudo_rand_int(&r, -2, 3);
+            const right_shift_t c_shr = pseudo_rand_int(&r, -2, 3);
+
+            for(int i = 0; i < N; i++){
+                b[i] = pseudo_rand_int32(&r);
+                c[i] = pseudo_rand_int32(&r);
+            }
+
+            xs3_vect_s32_zip(ref, b, c, N, b_shr, c_shr);
+            xs3_fft_index_bit_reversal(ref, N);
+
+            xs3_fft_zip_bit_reversal(a, b, c, N, b_shr, c_shr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) ref, (int32_t*) a, 2*N);
+
+            xs3_fft_zip_bit_reversal((complex_s32_t*) buff, b, c, N, b_shr, c_shr);
+            TEST_ASSERT_EQUAL_INT32_ARRAY((int32_t*) ref, buff, 2*N);
+        }
+    }
+}
+
+
+TEST(xs3_fft_helpers, xs3_fft_unzip_bit_reversal)
+{
+    unsigned r = 1;
+
+    for(unsigned k = MIN_N_LOG2; k <= MAX_PROC_FRAME_LENGTH_LOG2; k++){
+
+        unsigned N = (1<<k);
+        
+        for(unsigned t = 0; t <= (1<<LOOPS_LOG2); t++){
+
+            complex_s32_t DWORD_ALIGNED c[MAX_PROC_FRAME_LENGTH];
+            complex_s32_t DWORD_ALIGNED tmp[MAX_PROC_FRAME_LENGTH];
+            int32_t DWORD_ALIGNED a[MAX_PROC_FRAME_LENGTH];
+            int32_t DWORD_ALIGNED b[MAX_PROC_FRAME_LENGTH];
+            int32_t DWORD_ALIGNED ref[2*MAX_PROC_FRAME_LENGTH];
+
+            rand_vect_complex_s32(c, N, 0, &r);
+
+            memcpy(tmp, c, N * sizeof(complex_s32_t));
+            xs3_fft_index_bit_reversal(tmp, N);
+            xs3_vect_s32_unzip(&ref[0], &ref[N], tmp, N);
+
+            xs3_fft_unzip_bit_reversal(a, b, c, N);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(&ref[0], a, N);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(&ref[N], b, N);
+
+            // In-place, with the second output immediately following the first
+            int32_t* x = (int32_t*) c;
+            xs3_fft_unzip_bit_reversal(&x[0], &x[N], c, N);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(ref, x, 2*N);
+        }
+    }
+}
+
+
 TEST(xs3_fft_helpers, xs3_vect_complex_s32_tail_reverse)
 {
 #define FUNC_NAME "xs3_vect_complex_s32_tail_reverse"
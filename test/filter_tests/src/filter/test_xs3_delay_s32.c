@@ -0,0 +1,177 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_delay_s32) {
+  RUN_TEST_CASE(xs3_delay_s32, integer_delay);
+  RUN_TEST_CASE(xs3_delay_s32, fractional_delay);
+  RUN_TEST_CASE(xs3_delay_s32, read_taps);
+}
+
+TEST_GROUP(xs3_delay_s32);
+TEST_SETUP(xs3_delay_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_delay_s32) {}
+
+static char msg_buff[200];
+
+#define REPS        100
+#define MAX_LEN     64
+#define HIST_LEN    (REPS * MAX_LEN)
+
+
+static int32_t history[HIST_LEN];
+
+
+// Writes a block of `count` random samples to `delay`, also appending it to history[]. Returns new history length.
+static unsigned write_random_block(
+    xs3_delay_s32_t* delay,
+    unsigned hist_len,
+    const unsigned count,
+    unsigned* seed)
+{
+    for(int k = 0; k < count; k++)
+        history[hist_len + k] = pseudo_rand_int(seed, -0x10000000, 0x10000000);
+
+    xs3_delay_s32_write(delay, &history[hist_len], count);
+
+    return hist_len + count;
+}
+
+
+// Sample t of the history, with samples before time 0 being zero (as after xs3_delay_s32_init())
+static double hist(int t)
+{
+    return (t < 0)? 0.0 : (double) history[t];
+}
+
+
+TEST(xs3_delay_s32, integer_delay)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t buffer[MAX_LEN];
+    int32_t output[MAX_LEN];
+
+    xs3_delay_s32_t delay;
+
+    for(int v = 0; v < 10; v++){
+        const unsigned len = pseudo_rand_uint(&seed, 4, MAX_LEN+1);
+
+        xs3_delay_s32_init(&delay, buffer, len);
+        unsigned hist_len = 0;
+
+        for(int r = 0; r < REPS; r++){
+            const unsigned count = pseudo_rand_uint(&seed, 1, len - 2);
+            const unsigned D = pseudo_rand_uint(&seed, 1, len - count - 1);
+
+            sprintf(msg_buff, "( len: %u; rep: %d; count: %u; D: %u )", len, r, count, D);
+            UNITY_SET_DETAIL(msg_buff);
+
+            hist_len = write_random_block(&delay, hist_len, count, &seed);
+
+            xs3_delay_s32_read(&delay, output, count, D << 16);
+
+            for(int k = 0; k < count; k++){
+                const int t = hist_len - count + k - D;
+                TEST_ASSERT_EQUAL_INT32((t < 0)? 0 : history[t], output[k]);
+            }
+        }
+    }
+}
+
+
+TEST(xs3_delay_s32, fractional_delay)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t buffer[MAX_LEN];
+    int32_t output[MAX_LEN];
+
+    xs3_delay_s32_t delay;
+
+    for(int v = 0; v < 10; v++){
+        const unsigned len = pseudo_rand_uint(&seed, 4, MAX_LEN+1);
+
+        xs3_delay_s32_init(&delay, buffer, len);
+        unsigned hist_len = 0;
+
+        for(int r = 0; r < REPS; r++){
+            const unsigned count = pseudo_rand_uint(&seed, 1, len - 2);
+            const unsigned D = pseudo_rand_uint(&seed, 1, len - count - 1);
+            const unsigned frac = pseudo_rand_uint(&seed, 0, 0x10000);
+
+            sprintf(msg_buff, "( len: %u; rep: %d; count: %u; D: %u; frac: 0x%04X )", len, r, count, D, frac);
+            UNITY_SET_DETAIL(msg_buff);
+
+            hist_len = write_random_block(&delay, hist_len, count, &seed);
+
+            xs3_delay_s32_read(&delay, output, count, (D << 16) | frac);
+
+            const double mu = ldexp(frac, -16);
+            const double h[4] = {
+                -mu * (mu-1) * (mu-2) / 6,
+                (mu+1) * (mu-1) * (mu-2) / 2,
+                -(mu+1) * mu * (mu-2) / 2,
+                (mu+1) * mu * (mu-1) / 6 };
+
+            for(int k = 0; k < count; k++){
+                const int t = hist_len - count + k - D;
+                double expected = h[0] * hist(t+1) + h[1] * hist(t) + h[2] * hist(t-1) + h[3] * hist(t-2);
+
+                TEST_ASSERT_INT32_WITHIN(4, lround(expected), output[k]);
+            }
+        }
+    }
+}
+
+
+TEST(xs3_delay_s32, read_taps)
+{
+#define TAPS    6
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t buffer[MAX_LEN];
+    int32_t output[TAPS * MAX_LEN];
+    int32_t expected[MAX_LEN];
+    fixed_s32_t delays[TAPS];
+
+    xs3_delay_s32_t delay;
+
+    const unsigned len = MAX_LEN;
+    xs3_delay_s32_init(&delay, buffer, len);
+    unsigned hist_len = 0;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned count = pseudo_rand_uint(&seed, 1, 17);
+
+        sprintf(msg_buff, "( rep: %d; count: %u )", r, count);
+        UNITY_SET_DETAIL(msg_buff);
+
+        for(int i = 0; i < TAPS; i++)
+            delays[i] = pseudo_rand_uint(&seed, 0x10000, (len - count - 2) << 16);
+
+        hist_len = write_random_block(&delay, hist_len, count, &seed);
+
+        xs3_delay_s32_read_taps(&delay, output, count, delays, TAPS);
+
+        for(int i = 0; i < TAPS; i++){
+            xs3_delay_s32_read(&delay, expected, count, delays[i]);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(expected, &output[i * count], count);
+        }
+    }
+#undef TAPS
+}
@@ -0,0 +1,236 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_filter_crossover_s32) {
+  RUN_TEST_CASE(xs3_filter_crossover_s32, init);
+  RUN_TEST_CASE(xs3_filter_crossover_s32, allpass_sum);
+  RUN_TEST_CASE(xs3_filter_crossover_s32, dc);
+  RUN_TEST_CASE(xs3_filter_crossover_s32, blocks);
+}
+
+TEST_GROUP(xs3_filter_crossover_s32);
+TEST_SETUP(xs3_filter_crossover_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_filter_crossover_s32) {}
+
+static char msg_buff[200];
+
+#define REPS        30
+#define N_SAMPLES   300
+#define MAX_BANDS   XS3_FILTER_CROSSOVER_MAX_BANDS
+
+
+// Random ascending crossover gains, spaced so that the bands are distinct. Returns band count.
+static unsigned random_crossover(
+    fixed_s32_t K[],
+    unsigned* seed)
+{
+    const unsigned bands = pseudo_rand_uint(seed, 2, MAX_BANDS+1);
+    int32_t lo = 0x03000000;
+
+    for(int j = 0; j < bands - 1; j++){
+        const int32_t hi = 0x03000000 + (j+1) * (0x38000000 / (bands - 1));
+        K[j] = pseudo_rand_int(seed, lo, hi);
+        lo = K[j] + 0x01000000;
+    }
+
+    return bands;
+}
+
+
+// Denominator and Butterworth numerators at prewarped gain K, as doubles
+static void design_double(
+    double lp[3],
+    double hp[3],
+    double a[3],
+    const double K)
+{
+    const double norm = 1.0 / (1.0 + sqrt(2.0) * K + K*K);
+    lp[0] = K*K*norm;   lp[1] = 2*lp[0];    lp[2] = lp[0];
+    hp[0] = norm;       hp[1] = -2*norm;    hp[2] = norm;
+    a[0] = 1.0;         a[1] = 2*(K*K - 1)*norm;    a[2] = (1 - sqrt(2.0)*K + K*K)*norm;
+}
+
+
+static void biquad_double(
+    double y[],
+    const double x[],
+    const double b[3],
+    const double a[3],
+    const unsigned length)
+{
+    double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+    for(int n = 0; n < length; n++){
+        const double v = b[0]*x[n] + b[1]*x1 + b[2]*x2 - a[1]*y1 - a[2]*y2;
+        x2 = x1; x1 = x[n];
+        y2 = y1; y1 = v;
+        y[n] = v;
+    }
+}
+
+
+TEST(xs3_filter_crossover_s32, init)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    const unsigned expected_lanes[MAX_BANDS+1] = {0, 0, 4, 9, 14};
+    fixed_s32_t K[MAX_BANDS-1];
+    double lp[3], hp[3], a[3];
+    xs3_filter_crossover_s32_t xover;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned bands = random_crossover(K, &seed);
+
+        sprintf(msg_buff, "( rep: %d; bands: %u )", r, bands);
+        UNITY_SET_DETAIL(msg_buff);
+
+        xs3_filter_crossover_s32_init(&xover, bands, K);
+
+        TEST_ASSERT_EQUAL(bands, xover.band_count);
+        TEST_ASSERT_EQUAL(expected_lanes[bands], xover.section_count);
+
+        // The first lane is the first lowpass section of the middle split
+        design_double(lp, hp, a, ldexp(K[(bands-1)/2], -30));
+
+        TEST_ASSERT_EQUAL(0, xover.source[0]);
+        TEST_ASSERT_INT32_WITHIN(4, lround(ldexp(lp[0], 30)), xover.coef[0][0]);
+        TEST_ASSERT_INT32_WITHIN(4, lround(ldexp(lp[1], 30)), xover.coef[1][0]);
+        TEST_ASSERT_INT32_WITHIN(4, lround(ldexp(lp[2], 30)), xover.coef[2][0]);
+        TEST_ASSERT_INT32_WITHIN(4, lround(ldexp(-a[1], 30)), xover.coef[3][0]);
+        TEST_ASSERT_INT32_WITHIN(4, lround(ldexp(-a[2], 30)), xover.coef[4][0]);
+
+        // Every lane's input comes from the crossover input or an earlier lane
+        for(int i = 0; i < xover.section_count; i++)
+            TEST_ASSERT(xover.source[i] <= i);
+    }
+}
+
+
+TEST(xs3_filter_crossover_s32, allpass_sum)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t K[MAX_BANDS-1];
+    int32_t x[N_SAMPLES];
+    int32_t bands_out[MAX_BANDS * N_SAMPLES];
+    double expected[N_SAMPLES];
+    double tmp[N_SAMPLES];
+    double lp[3], hp[3], a[3];
+    xs3_filter_crossover_s32_t xover;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned bands = random_crossover(K, &seed);
+
+        sprintf(msg_buff, "( rep: %d; bands: %u )", r, bands);
+        UNITY_SET_DETAIL(msg_buff);
+
+        for(int n = 0; n < N_SAMPLES; n++){
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+            expected[n] = x[n];
+        }
+
+        xs3_filter_crossover_s32_init(&xover, bands, K);
+        xs3_filter_crossover_s32(&xover, bands_out, x, N_SAMPLES);
+
+        // The bands of an LR4 crossover sum to the cascade of the allpasses at each crossover frequency
+        for(int j = 0; j < bands - 1; j++){
+            design_double(lp, hp, a, ldexp(K[j], -30));
+            const double ap[3] = { a[2], a[1], a[0] };
+            memcpy(tmp, expected, sizeof(tmp));
+            biquad_double(expected, tmp, ap, a, N_SAMPLES);
+        }
+
+        for(int n = 0; n < N_SAMPLES; n++){
+            int64_t sum = 0;
+            for(int b = 0; b < bands; b++)
+                sum += bands_out[b * N_SAMPLES + n];
+
+            TEST_ASSERT_INT32_WITHIN(0x400, lround(expected[n]), (int32_t) sum);
+        }
+    }
+}
+
+
+TEST(xs3_filter_crossover_s32, dc)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t K[MAX_BANDS-1];
+    int32_t x[N_SAMPLES];
+    int32_t bands_out[MAX_BANDS * N_SAMPLES];
+    xs3_filter_crossover_s32_t xover;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned bands = random_crossover(K, &seed);
+
+        sprintf(msg_buff, "( rep: %d; bands: %u )", r, bands);
+        UNITY_SET_DETAIL(msg_buff);
+
+        const int32_t level = pseudo_rand_int(&seed, -0x10000000, 0x10000000);
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = level;
+
+        xs3_filter_crossover_s32_init(&xover, bands, K);
+        xs3_filter_crossover_s32(&xover, bands_out, x, N_SAMPLES);
+
+        // After settling, a constant input appears only in the lowest band
+        const int n = N_SAMPLES - 1;
+        TEST_ASSERT_INT32_WITHIN(0x400, level, bands_out[n]);
+        for(int b = 1; b < bands; b++)
+            TEST_ASSERT_INT32_WITHIN(0x400, 0, bands_out[b * N_SAMPLES + n]);
+    }
+}
+
+
+TEST(xs3_filter_crossover_s32, blocks)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t K[MAX_BANDS-1];
+    int32_t x[N_SAMPLES];
+    int32_t whole[MAX_BANDS * N_SAMPLES];
+    int32_t split[MAX_BANDS * N_SAMPLES];
+    int32_t blk[MAX_BANDS * 32];
+    xs3_filter_crossover_s32_t xover;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned bands = random_crossover(K, &seed);
+
+        sprintf(msg_buff, "( rep: %d; bands: %u )", r, bands);
+        UNITY_SET_DETAIL(msg_buff);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_crossover_s32_init(&xover, bands, K);
+        xs3_filter_crossover_s32(&xover, whole, x, N_SAMPLES);
+
+        xs3_filter_crossover_s32_init(&xover, bands, K);
+
+        for(unsigned n = 0; n < N_SAMPLES; ){
+            const unsigned max_len = pseudo_rand_uint(&seed, 1, 33);
+            const unsigned len = MIN(N_SAMPLES - n, max_len);
+            xs3_filter_crossover_s32(&xover, blk, &x[n], len);
+
+            for(int b = 0; b < bands; b++)
+                memcpy(&split[b * N_SAMPLES + n], &blk[b * len], len * sizeof(int32_t));
+            n += len;
+        }
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(whole, split, bands * N_SAMPLES);
+    }
+}
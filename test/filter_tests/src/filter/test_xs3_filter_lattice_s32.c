@@ -0,0 +1,216 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_filter_lattice_s32) {
+  RUN_TEST_CASE(xs3_filter_lattice_s32, all_pole);
+  RUN_TEST_CASE(xs3_filter_lattice_s32, pole_zero);
+  RUN_TEST_CASE(xs3_filter_lattice_s32, blocks);
+}
+
+TEST_GROUP(xs3_filter_lattice_s32);
+TEST_SETUP(xs3_filter_lattice_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_filter_lattice_s32) {}
+
+static char msg_buff[200];
+
+#define REPS        50
+#define MAX_ORDER   24
+#define N_SAMPLES   200
+
+
+static void random_coefs(
+    int32_t refl[],
+    int32_t ladder[],
+    const unsigned order,
+    unsigned* seed)
+{
+    // Reflection coefficients of magnitude below 0.75 keep the filter gain within a sensible range
+    for(int m = 0; m < order; m++)
+        refl[m] = pseudo_rand_int(seed, -0x30000000, 0x30000000);
+
+    if(ladder != NULL)
+        for(int m = 0; m <= order; m++)
+            ladder[m] = pseudo_rand_int(seed, -0x10000000, 0x10000000);
+}
+
+
+// Floating-point reference. Returns all-pole output, and pole-zero output in `y_pz` if `ladder` is not NULL.
+static void lattice_double(
+    double y[],
+    const int32_t x[],
+    const int32_t refl[],
+    const int32_t ladder[],
+    const unsigned order,
+    const unsigned length)
+{
+    double g[MAX_ORDER] = {0};
+
+    for(int n = 0; n < length; n++){
+        double f = x[n];
+        double acc = 0;
+
+        for(int m = order; m > 0; m--){
+            const double k = ldexp(refl[m-1], -30);
+            f = f - k * g[m-1];
+            const double g_m = k * f + g[m-1];
+            if(ladder) acc += ldexp(ladder[m], -30) * g_m;
+            if(m < order) g[m] = g_m;
+        }
+
+        g[0] = f;
+        y[n] = ladder? (acc + ldexp(ladder[0], -30) * f) : f;
+    }
+}
+
+
+TEST(xs3_filter_lattice_s32, all_pole)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t refl[MAX_ORDER];
+    int32_t state[MAX_ORDER];
+    int32_t x[N_SAMPLES];
+    int32_t y[N_SAMPLES];
+    double a[MAX_ORDER+1];
+    double a_prev[MAX_ORDER+1];
+    double y_exp[N_SAMPLES];
+
+    xs3_filter_lattice_s32_t filter;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned order = pseudo_rand_uint(&seed, 1, MAX_ORDER+1);
+
+        sprintf(msg_buff, "( rep: %d; order: %u )", r, order);
+        UNITY_SET_DETAIL(msg_buff);
+
+        random_coefs(refl, NULL, order, &seed);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_lattice_s32_init(&filter, state, order, refl, NULL);
+        xs3_filter_lattice_s32(&filter, y, x, N_SAMPLES);
+
+        // Convert reflection coefficients to direct form A(z) with the step-up recursion
+        a[0] = 1.0;
+        for(int m = 1; m <= order; m++){
+            memcpy(a_prev, a, sizeof(a));
+            const double k = ldexp(refl[m-1], -30);
+            for(int i = 1; i < m; i++)
+                a[i] = a_prev[i] + k * a_prev[m-i];
+            a[m] = k;
+        }
+
+        // y[n] = x[n] - sum_i a_i y[n-i]
+        for(int n = 0; n < N_SAMPLES; n++){
+            y_exp[n] = x[n];
+            for(int i = 1; i <= order && i <= n; i++)
+                y_exp[n] -= a[i] * y_exp[n-i];
+        }
+
+        double peak = 0;
+        for(int n = 0; n < N_SAMPLES; n++)
+            peak = MAX(peak, fabs(y_exp[n]));
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            TEST_ASSERT_INT32_WITHIN(order + 1 + (int32_t) ldexp(peak, -16), lround(y_exp[n]), y[n]);
+    }
+}
+
+
+TEST(xs3_filter_lattice_s32, pole_zero)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t refl[MAX_ORDER];
+    int32_t ladder[MAX_ORDER+1];
+    int32_t state[MAX_ORDER];
+    int32_t x[N_SAMPLES];
+    int32_t y[N_SAMPLES];
+    double y_exp[N_SAMPLES];
+
+    xs3_filter_lattice_s32_t filter;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned order = pseudo_rand_uint(&seed, 1, MAX_ORDER+1);
+
+        sprintf(msg_buff, "( rep: %d; order: %u )", r, order);
+        UNITY_SET_DETAIL(msg_buff);
+
+        random_coefs(refl, ladder, order, &seed);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_lattice_s32_init(&filter, state, order, refl, ladder);
+        xs3_filter_lattice_s32(&filter, y, x, N_SAMPLES);
+
+        lattice_double(y_exp, x, refl, ladder, order, N_SAMPLES);
+
+        double peak = 0;
+        for(int n = 0; n < N_SAMPLES; n++)
+            peak = MAX(peak, fabs(y_exp[n]));
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            TEST_ASSERT_INT32_WITHIN(order + 1 + (int32_t) ldexp(peak, -16), lround(y_exp[n]), y[n]);
+    }
+}
+
+
+TEST(xs3_filter_lattice_s32, blocks)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t refl[MAX_ORDER];
+    int32_t ladder[MAX_ORDER+1];
+    int32_t state[MAX_ORDER];
+    int32_t x[N_SAMPLES];
+    int32_t y_whole[N_SAMPLES];
+    int32_t y[N_SAMPLES];
+
+    xs3_filter_lattice_s32_t filter;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned order = pseudo_rand_uint(&seed, 1, MAX_ORDER+1);
+        const int all_pole = pseudo_rand_uint(&seed, 0, 2);
+
+        sprintf(msg_buff, "( rep: %d; order: %u; all_pole: %d )", r, order, all_pole);
+        UNITY_SET_DETAIL(msg_buff);
+
+        random_coefs(refl, ladder, order, &seed);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_lattice_s32_init(&filter, state, order, refl, all_pole? NULL : ladder);
+        xs3_filter_lattice_s32(&filter, y_whole, x, N_SAMPLES);
+
+        // Process again in random-sized blocks, in-place
+        memcpy(y, x, sizeof(x));
+        xs3_filter_lattice_s32_init(&filter, state, order, refl, all_pole? NULL : ladder);
+
+        for(unsigned n = 0; n < N_SAMPLES; ){
+            const unsigned max_count = pseudo_rand_uint(&seed, 1, 33);
+            const unsigned count = MIN(N_SAMPLES - n, max_count);
+            xs3_filter_lattice_s32(&filter, &y[n], &y[n], count);
+            n += count;
+        }
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(y_whole, y, N_SAMPLES);
+    }
+}
@@ -0,0 +1,177 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../src/vect/vpu_helper.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_filter_svf_bank_s32) {
+  RUN_TEST_CASE(xs3_filter_svf_bank_s32, init);
+  RUN_TEST_CASE(xs3_filter_svf_bank_s32, response);
+  RUN_TEST_CASE(xs3_filter_svf_bank_s32, blocks);
+}
+
+TEST_GROUP(xs3_filter_svf_bank_s32);
+TEST_SETUP(xs3_filter_svf_bank_s32) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_filter_svf_bank_s32) {}
+
+static char msg_buff[200];
+
+#define REPS        50
+#define N_SAMPLES   200
+
+
+static unsigned random_bank(
+    fixed_s32_t g[8],
+    fixed_s32_t k[8],
+    unsigned* seed)
+{
+    const unsigned count = pseudo_rand_uint(seed, 1, 9);
+
+    for(int i = 0; i < count; i++){
+        g[i] = pseudo_rand_int(seed, 0x00100000, 0x60000000);
+        k[i] = pseudo_rand_int(seed, 0x10000000, 0x78000000);
+    }
+
+    return count;
+}
+
+
+TEST(xs3_filter_svf_bank_s32, init)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t g[8], k[8];
+    xs3_filter_svf_bank_s32_t bank;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned count = random_bank(g, k, &seed);
+
+        sprintf(msg_buff, "( rep: %d; count: %u )", r, count);
+        UNITY_SET_DETAIL(msg_buff);
+
+        xs3_filter_svf_bank_s32_init(&bank, count, g, k);
+
+        TEST_ASSERT_EQUAL(count, bank.filter_count);
+
+        for(int i = 0; i < count; i++){
+            const double g_f = ldexp(g[i], -30);
+            const double k_f = ldexp(k[i], -30);
+            const double a1 = 1.0 / (1.0 + g_f * (g_f + k_f));
+
+            TEST_ASSERT_INT32_WITHIN(2, lround(ldexp(a1, 30)), bank.coef[0][i]);
+            TEST_ASSERT_INT32_WITHIN(2, lround(ldexp(g_f * a1, 30)), bank.coef[1][i]);
+            TEST_ASSERT_INT32_WITHIN(2, lround(ldexp(g_f * g_f * a1, 30)), bank.coef[2][i]);
+            TEST_ASSERT_EQUAL_INT32(k[i], bank.coef[3][i]);
+            TEST_ASSERT_EQUAL_INT32(0, bank.state[0][i]);
+            TEST_ASSERT_EQUAL_INT32(0, bank.state[1][i]);
+        }
+    }
+}
+
+
+TEST(xs3_filter_svf_bank_s32, response)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t g[8], k[8];
+    int32_t x[N_SAMPLES];
+    int32_t low[8 * N_SAMPLES];
+    int32_t band[8 * N_SAMPLES];
+    int32_t high[8 * N_SAMPLES];
+    xs3_filter_svf_bank_s32_t bank;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned count = random_bank(g, k, &seed);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_svf_bank_s32_init(&bank, count, g, k);
+        xs3_filter_svf_bank_s32(&bank, low, band, high, x, N_SAMPLES);
+
+        for(int i = 0; i < count; i++){
+            sprintf(msg_buff, "( rep: %d; filter: %d )", r, i);
+            UNITY_SET_DETAIL(msg_buff);
+
+            // Reference using the bank's (quantized) coefficients
+            const double a1 = ldexp(bank.coef[0][i], -30);
+            const double a2 = ldexp(bank.coef[1][i], -30);
+            const double a3 = ldexp(bank.coef[2][i], -30);
+            const double k_f = ldexp(bank.coef[3][i], -30);
+            double s1 = 0, s2 = 0;
+
+            for(int n = 0; n < N_SAMPLES; n++){
+                const double v3 = x[n] - s2;
+                const double v1 = a1 * s1 + a2 * v3;
+                const double v2 = s2 + a2 * s1 + a3 * v3;
+                s1 = 2 * v1 - s1;
+                s2 = 2 * v2 - s2;
+
+                TEST_ASSERT_INT32_WITHIN(64, lround(v2), low[i * N_SAMPLES + n]);
+                TEST_ASSERT_INT32_WITHIN(64, lround(v1), band[i * N_SAMPLES + n]);
+                TEST_ASSERT_INT32_WITHIN(64, lround(x[n] - k_f * v1 - v2), high[i * N_SAMPLES + n]);
+            }
+        }
+    }
+}
+
+
+TEST(xs3_filter_svf_bank_s32, blocks)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    fixed_s32_t g[8], k[8];
+    int32_t x[N_SAMPLES];
+    int32_t low_whole[8 * N_SAMPLES];
+    int32_t high_whole[8 * N_SAMPLES];
+    int32_t low[8 * N_SAMPLES];
+    int32_t high[8 * N_SAMPLES];
+    xs3_filter_svf_bank_s32_t bank;
+
+    for(int r = 0; r < REPS; r++){
+        const unsigned count = random_bank(g, k, &seed);
+
+        sprintf(msg_buff, "( rep: %d; count: %u )", r, count);
+        UNITY_SET_DETAIL(msg_buff);
+
+        for(int n = 0; n < N_SAMPLES; n++)
+            x[n] = pseudo_rand_int(&seed, -0x1000000, 0x1000000);
+
+        xs3_filter_svf_bank_s32_init(&bank, count, g, k);
+        xs3_filter_svf_bank_s32(&bank, low_whole, NULL, high_whole, x, N_SAMPLES);
+
+        xs3_filter_svf_bank_s32_init(&bank, count, g, k);
+
+        for(unsigned n = 0; n < N_SAMPLES; ){
+            const unsigned max_len = pseudo_rand_uint(&seed, 1, 33);
+            const unsigned len = MIN(N_SAMPLES - n, max_len);
+            int32_t low_blk[8 * 32];
+            int32_t high_blk[8 * 32];
+
+            xs3_filter_svf_bank_s32(&bank, low_blk, NULL, high_blk, &x[n], len);
+
+            for(int i = 0; i < count; i++){
+                memcpy(&low[i * N_SAMPLES + n], &low_blk[i * len], len * sizeof(int32_t));
+                memcpy(&high[i * N_SAMPLES + n], &high_blk[i * len], len * sizeof(int32_t));
+            }
+            n += len;
+        }
+
+        for(int i = 0; i < count; i++){
+            TEST_ASSERT_EQUAL_INT32_ARRAY(&low_whole[i * N_SAMPLES], &low[i * N_SAMPLES], N_SAMPLES);
+            TEST_ASSERT_EQUAL_INT32_ARRAY(&high_whole[i * N_SAMPLES], &high[i * N_SAMPLES], N_SAMPLES);
+        }
+    }
+}
@@ -14,6 +14,10 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(xs3_filter_fir_s32);
     RUN_TEST_GROUP(xs3_push_sample);
     RUN_TEST_GROUP(xs3_filter_biquad_s32);
+    RUN_TEST_GROUP(xs3_filter_lattice_s32);
+    RUN_TEST_GROUP(xs3_filter_svf_bank_s32);
+    RUN_TEST_GROUP(xs3_filter_crossover_s32);
+    RUN_TEST_GROUP(xs3_delay_s32);
 
     return UNITY_END();
 }
@@ -6,6 +6,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 #ifdef __xcore__
  #include "xcore/hwtimer.h"
@@ -20,7 +21,9 @@ unsigned get_seed(
   int left = len;
 
   while(left > 0){
-    unsigned v = ((unsigned*)str)[0];
+    // Don't read past the end of the string; the seed would depend on whatever follows it
+    unsigned v = 0;
+    memcpy(&v, str, (left >= 4)? 4 : left);
     seed = seed ^ v;
     left -= 4;
     str = &str[4];
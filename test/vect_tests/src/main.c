@@ -24,6 +24,11 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(xs3_vect_scale);
     RUN_TEST_GROUP(xs3_vect_abs);
     RUN_TEST_GROUP(xs3_vect_clip);
+    RUN_TEST_GROUP(xs3_vect_softclip);
+    RUN_TEST_GROUP(xs3_vect_cumsum);
+    RUN_TEST_GROUP(xs3_vect_pyramid);
+    RUN_TEST_GROUP(xs3_vect_vad);
+    RUN_TEST_GROUP(xs3_vect_elementwise);
     RUN_TEST_GROUP(xs3_vect_rect);
     RUN_TEST_GROUP(xs3_vect_inverse);
     RUN_TEST_GROUP(xs3_vect_sum);
@@ -34,6 +39,11 @@ int main(int argc, const char* argv[])
     RUN_TEST_GROUP(xs3_vect_argmax);
     RUN_TEST_GROUP(xs3_vect_argmin);
     RUN_TEST_GROUP(xs3_vect_energy);
+    RUN_TEST_GROUP(xs3_vect_abs_max_energy);
+    RUN_TEST_GROUP(xs3_vect_stats);
+    RUN_TEST_GROUP(xs3_vect_moments);
+    RUN_TEST_GROUP(xs3_vect_topk);
+    RUN_TEST_GROUP(xs3_vect_histogram);
     RUN_TEST_GROUP(xs3_vect_sqrt);
     RUN_TEST_GROUP(xs3_vect_bitdepth_convert);
     RUN_TEST_GROUP(xs3_vect_macc);
@@ -19,6 +19,7 @@ TEST_GROUP_RUNNER(xs3_vect_complex_real_mul) {
   RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s16_real_mul_prepare);
   RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s16_real_mul_basic);
   RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s16_real_mul_random);
+  RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s32_real_mul_prepare);
   RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s32_real_mul_basic);
   RUN_TEST_CASE(xs3_vect_complex_real_mul, xs3_vect_complex_s32_real_mul_random);
 }
@@ -430,3 +431,48 @@ TEST(xs3_vect_complex_real_mul, xs3_vect_complex_s32_real_mul_random)
 #undef MAX_LEN
 #undef REPS
 
+
+
+#define REPS        ((SMOKE_TEST)?100:1000)
+TEST(xs3_vect_complex_real_mul, xs3_vect_complex_s32_real_mul_prepare)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    complex_s32_t A;
+    complex_s32_t B;
+    int32_t C;
+
+    for(int r = 0; r < REPS; r++){
+        setExtraInfo_RS(r, seed);
+
+        const exponent_t B_exp = pseudo_rand_int(&seed, -100, 100);
+        const exponent_t C_exp = pseudo_rand_int(&seed, -100, 100);
+
+        // The first case has mismatched headroom for which c used to be shifted left past its headroom.
+        const headroom_t B_hr = (r == 0)? 4 : pseudo_rand_uint(&seed, 0, 28);
+        const headroom_t C_hr = (r == 0)? 1 : pseudo_rand_uint(&seed, 0, 28);
+
+        exponent_t A_exp;
+        right_shift_t b_shr, c_shr;
+
+        xs3_vect_complex_s32_real_mul_prepare(&A_exp, &b_shr, &c_shr, B_exp, C_exp, B_hr, C_hr);
+
+        // Neither operand may be shifted left by more than its headroom
+        TEST_ASSERT_GREATER_OR_EQUAL(-((int)B_hr), b_shr);
+        TEST_ASSERT_GREATER_OR_EQUAL(-((int)C_hr), c_shr);
+        TEST_ASSERT_EQUAL(B_exp + C_exp + b_shr + c_shr + 30, A_exp);
+
+        // Largest magnitudes with the given headroom must not saturate
+        B.re = INT32_MAX >> B_hr;
+        B.im = -B.re;
+        C = INT32_MAX >> C_hr;
+
+        xs3_vect_complex_s32_real_mul(&A, &B, &C, 1, b_shr, c_shr);
+
+        const double expected = ldexp(B.re, B_exp) * ldexp(C, C_exp);
+
+        TEST_ASSERT( fabs(ldexp(A.re, A_exp) - expected) <= ldexp(5, A_exp) );
+        TEST_ASSERT( fabs(ldexp(A.im, A_exp) + expected) <= ldexp(5, A_exp) );
+    }
+}
+#undef REPS
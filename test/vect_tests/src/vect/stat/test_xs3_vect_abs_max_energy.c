@@ -0,0 +1,73 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_abs_max_energy) {
+  RUN_TEST_CASE(xs3_vect_abs_max_energy, xs3_vect_s32_abs_max_energy);
+}
+
+TEST_GROUP(xs3_vect_abs_max_energy);
+TEST_SETUP(xs3_vect_abs_max_energy) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_abs_max_energy) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(xs3_vect_abs_max_energy, xs3_vect_s32_abs_max_energy)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t hr = pseudo_rand_uint32(&seed) % 8;
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> hr;
+
+        // Occasionally include the most negative value, whose magnitude saturates
+        if(hr == 0 && (pseudo_rand_uint32(&seed) & 1))
+            B[pseudo_rand_uint32(&seed) % len] = INT32_MIN;
+
+        exponent_t a_exp;
+        right_shift_t b_shr;
+        xs3_vect_s32_energy_prepare(&a_exp, &b_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        int32_t expected_max = 0;
+        for(int i = 0; i < len; i++){
+            const int32_t mag = (B[i] == INT32_MIN)? INT32_MAX : abs(B[i]);
+            expected_max = MAX(expected_max, mag);
+        }
+
+        const int64_t expected_energy = xs3_vect_s32_energy(B, len, b_shr);
+
+        int64_t energy;
+        int32_t max_abs = xs3_vect_s32_abs_max_energy(&energy, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT32(expected_max, max_abs);
+        TEST_ASSERT_EQUAL_INT64(expected_energy, energy);
+    }
+}
@@ -0,0 +1,130 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_histogram) {
+  RUN_TEST_CASE(xs3_vect_histogram, xs3_vect_s32_histogram);
+  RUN_TEST_CASE(xs3_vect_histogram, xs3_vect_s32_nth_element);
+}
+
+TEST_GROUP(xs3_vect_histogram);
+TEST_SETUP(xs3_vect_histogram) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_histogram) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+#define MAX_BINS     (40)
+
+
+static int compare_s32(const void* a, const void* b)
+{
+    const int32_t x = *(const int32_t*)a;
+    const int32_t y = *(const int32_t*)b;
+    return (x > y) - (x < y);
+}
+
+
+TEST(xs3_vect_histogram, xs3_vect_s32_histogram)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    unsigned counts[MAX_BINS];
+    unsigned expected[MAX_BINS];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const unsigned bins = pseudo_rand_uint(&seed, 1, MAX_BINS+1);
+        const right_shift_t bin_shr = pseudo_rand_uint(&seed, 0, 32);
+        const int32_t lower = pseudo_rand_int32(&seed);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed);
+
+        // Some elements exactly on bin edges
+        for(int i = 0; i < len; i += 3){
+            const int64_t edge = ((int64_t)lower) + (((int64_t)pseudo_rand_uint(&seed, 0, bins+1)) << bin_shr);
+            if(edge >= INT32_MIN && edge <= INT32_MAX)
+                B[i] = (int32_t) edge;
+        }
+
+        memset(expected, 0, sizeof(expected));
+        for(int i = 0; i < len; i++){
+            int j = 0;
+            while(j < bins - 1 && ((int64_t)B[i]) >= ((int64_t)lower) + (((int64_t)(j+1)) << bin_shr))
+                j++;
+            expected[j]++;
+        }
+
+        counts[0] = 0xFFFFFFFF;
+        xs3_vect_s32_histogram(counts, B, len, bins, lower, bin_shr);
+
+        TEST_ASSERT_EQUAL_UINT32_ARRAY(expected, counts, bins);
+    }
+}
+
+
+TEST(xs3_vect_histogram, xs3_vect_s32_nth_element)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int32_t sorted[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        // Sometimes only a few distinct values, so that there are many ties
+        const right_shift_t shr = (pseudo_rand_uint32(&seed) & 1)? 29 : 0;
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> shr;
+
+        // Sometimes already sorted
+        if(pseudo_rand_uint32(&seed) % 4 == 0)
+            qsort(B, len, sizeof(int32_t), compare_s32);
+
+        memcpy(sorted, B, sizeof(B));
+        qsort(sorted, len, sizeof(int32_t), compare_s32);
+
+        const unsigned n = pseudo_rand_uint(&seed, 0, len);
+
+        const int32_t result = xs3_vect_s32_nth_element(B, len, n);
+
+        TEST_ASSERT_EQUAL_INT32(sorted[n], result);
+        TEST_ASSERT_EQUAL_INT32(sorted[n], B[n]);
+
+        for(int i = 0; i < n; i++)
+            TEST_ASSERT(B[i] <= B[n]);
+        for(int i = n+1; i < len; i++)
+            TEST_ASSERT(B[i] >= B[n]);
+
+        // Only reordered
+        qsort(B, len, sizeof(int32_t), compare_s32);
+        TEST_ASSERT_EQUAL_INT32_ARRAY(sorted, B, len);
+    }
+}
@@ -0,0 +1,121 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_moments) {
+  RUN_TEST_CASE(xs3_vect_moments, xs3_vect_s32_moments);
+  RUN_TEST_CASE(xs3_vect_moments, xs3_vect_s32_affine);
+}
+
+TEST_GROUP(xs3_vect_moments);
+TEST_SETUP(xs3_vect_moments) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_moments) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(xs3_vect_moments, xs3_vect_s32_moments)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t hr = pseudo_rand_uint32(&seed) % 20;
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> hr;
+
+        // Sometimes make the vector all-positive, with a spread much smaller than its mean
+        if(pseudo_rand_uint32(&seed) & 1){
+            for(int i = 0; i < len; i++)
+                B[i] = ((uint32_t)0x40000000 >> hr) + (B[i] >> 8);
+        }
+
+        const int32_t pivot = B[pseudo_rand_uint32(&seed) % len];
+
+        exponent_t a_exp;
+        right_shift_t b_shr;
+        xs3_vect_s32_moments_prepare(&a_exp, &b_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        TEST_ASSERT_EQUAL_INT32(b_shr, a_exp);
+
+        int64_t exp_sum = 0;
+        int64_t exp_sum_sq = 0;
+
+        for(int i = 0; i < len; i++){
+            const int64_t d = (int64_t) floor(ldexp(((double)B[i]) - pivot, -b_shr) + 0.5);
+            exp_sum += d;
+            exp_sum_sq += d * d;
+        }
+
+        int64_t sum, sum_sq;
+        xs3_vect_s32_moments(&sum, &sum_sq, B, len, pivot, b_shr);
+
+        TEST_ASSERT_EQUAL_INT64(exp_sum, sum);
+        TEST_ASSERT_EQUAL_INT64(exp_sum_sq, sum_sq);
+    }
+}
+
+
+TEST(xs3_vect_moments, xs3_vect_s32_affine)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED A[MAX_LEN];
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int32_t expA[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t b_hr = pseudo_rand_uint32(&seed) % 8;
+        const headroom_t s_hr = pseudo_rand_uint32(&seed) % 8;
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> b_hr;
+
+        const int32_t scale = pseudo_rand_int32(&seed) >> s_hr;
+        const int64_t offset = ((int64_t)pseudo_rand_int32(&seed)) * (pseudo_rand_int32(&seed) >> 1);
+        const right_shift_t a_shr = pseudo_rand_int(&seed, -4, 40);
+
+        for(int i = 0; i < len; i++){
+            double p = ldexp(((double)B[i]) * scale + (double) offset, -a_shr);
+            p = round(p);
+            expA[i] = (p >= INT32_MAX)? INT32_MAX : (p <= -INT32_MAX)? -INT32_MAX : (int32_t) p;
+        }
+
+        headroom_t hr = xs3_vect_s32_affine(A, B, len, scale, offset, a_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_INT32_WITHIN(1, expA[i], A[i]);
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+    }
+}
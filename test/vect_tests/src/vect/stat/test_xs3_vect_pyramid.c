@@ -0,0 +1,93 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_pyramid) {
+  RUN_TEST_CASE(xs3_vect_pyramid, xs3_vect_s32_pyramid);
+}
+
+TEST_GROUP(xs3_vect_pyramid);
+TEST_SETUP(xs3_vect_pyramid) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_pyramid) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (128)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (1024)
+#endif
+
+
+TEST(xs3_vect_pyramid, xs3_vect_s32_pyramid)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int32_t WORD_ALIGNED M[MAX_LEN];
+    int32_t WORD_ALIGNED m[MAX_LEN];
+    int32_t WORD_ALIGNED P[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        const unsigned levels = pseudo_rand_uint(&seed, 1, 7);
+        const unsigned blocks = pseudo_rand_uint(&seed, 1, (MAX_LEN >> levels) + 1);
+        const unsigned len = blocks << levels;
+
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 20);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> b_hr;
+
+        const headroom_t hr = xs3_vect_s32_headroom(B, len);
+        const right_shift_t sq_shr = 32 - 2 * hr;
+
+        xs3_vect_s32_pyramid(M, m, P, B, len, levels, sq_shr);
+
+        unsigned offset = 0;
+
+        for(int l = 1; l <= levels; l++){
+            const unsigned count = len >> l;
+            const unsigned block = 1 << l;
+
+            TEST_ASSERT_EQUAL(len - (len >> (l-1)), offset);
+
+            for(int k = 0; k < count; k++){
+                int32_t exp_max = INT32_MIN;
+                int32_t exp_min = INT32_MAX;
+                double exp_ms = 0;
+
+                for(int i = k * block; i < (k+1) * block; i++){
+                    exp_max = MAX(exp_max, B[i]);
+                    exp_min = MIN(exp_min, B[i]);
+                    exp_ms += ldexp(((double) B[i]) * B[i], -sq_shr);
+                }
+                exp_ms /= block;
+
+                TEST_ASSERT_EQUAL_INT32(exp_max, M[offset + k]);
+                TEST_ASSERT_EQUAL_INT32(exp_min, m[offset + k]);
+
+                // Rounding at each level adds up to half an LSB
+                TEST_ASSERT(fabs(P[offset + k] - exp_ms) <= 0.5 * l + 0.01);
+                TEST_ASSERT(P[offset + k] >= 0 && P[offset + k] <= 0x40000000);
+            }
+
+            offset += count;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_stats) {
+  RUN_TEST_CASE(xs3_vect_stats, xs3_vect_s32_stats);
+  RUN_TEST_CASE(xs3_vect_stats, xs3_vect_s32_stats_long);
+}
+
+TEST_GROUP(xs3_vect_stats);
+TEST_SETUP(xs3_vect_stats) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_stats) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(xs3_vect_stats, xs3_vect_s32_stats)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        // Enough headroom that xs3_vect_s32_sum() doesn't saturate
+        const headroom_t hr = (pseudo_rand_uint32(&seed) % 8) + 1;
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> hr;
+
+        // Repeated extreme values, to check which index is reported
+        if(pseudo_rand_uint32(&seed) & 1){
+            B[pseudo_rand_uint32(&seed) % len] = B[xs3_vect_s32_argmax(B, len)];
+            B[pseudo_rand_uint32(&seed) % len] = B[xs3_vect_s32_argmin(B, len)];
+        }
+
+        exponent_t a_exp;
+        right_shift_t b_shr;
+        xs3_vect_s32_energy_prepare(&a_exp, &b_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        xs3_vect_s32_stats_t stats;
+        xs3_vect_s32_stats(&stats, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT32(xs3_vect_s32_max(B, len), stats.max);
+        TEST_ASSERT_EQUAL_INT32(xs3_vect_s32_min(B, len), stats.min);
+        TEST_ASSERT_EQUAL_UINT32(xs3_vect_s32_argmax(B, len), stats.argmax);
+        TEST_ASSERT_EQUAL_UINT32(xs3_vect_s32_argmin(B, len), stats.argmin);
+        TEST_ASSERT_EQUAL_INT64(xs3_vect_s32_sum(B, len), stats.sum);
+        TEST_ASSERT_EQUAL_INT64(xs3_vect_s32_energy(B, len, b_shr), stats.energy);
+    }
+}
+
+
+#define LONG_LEN    (1024)
+TEST(xs3_vect_stats, xs3_vect_s32_stats_long)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[LONG_LEN];
+
+    for(int v = 0; v < REPS / 10; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % (LONG_LEN - 256)) + 257;
+        setExtraInfo_RSL(v, seed, len);
+
+        // Full-scale elements. When they all have the same sign, the 40-bit sum saturates.
+        const int sign = pseudo_rand_uint32(&seed) % 3;
+        int64_t exact = 0;
+
+        for(int i = 0; i < len; i++){
+            B[i] = pseudo_rand_int32(&seed);
+            B[i] = (sign == 0)? B[i] : (sign == 1)? (B[i] | 0x40000000) & INT32_MAX : (B[i] | INT32_MIN) & ~0x40000000;
+            exact += B[i];
+        }
+
+        exponent_t a_exp;
+        right_shift_t b_shr;
+        xs3_vect_s32_energy_prepare(&a_exp, &b_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        xs3_vect_s32_stats_t stats;
+        xs3_vect_s32_stats(&stats, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT64(xs3_vect_s32_sum(B, len), stats.sum);
+        TEST_ASSERT_EQUAL_INT64(xs3_vect_s32_energy(B, len, b_shr), stats.energy);
+
+        if(sign != 0)
+            TEST_ASSERT(llabs(stats.sum) < llabs(exact));
+    }
+}
+#undef LONG_LEN
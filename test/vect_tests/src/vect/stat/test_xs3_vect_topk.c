@@ -0,0 +1,81 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_topk) {
+  RUN_TEST_CASE(xs3_vect_topk, xs3_vect_s32_topk);
+}
+
+TEST_GROUP(xs3_vect_topk);
+TEST_SETUP(xs3_vect_topk) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_topk) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(xs3_vect_topk, xs3_vect_s32_topk)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    unsigned indices[MAX_LEN];
+    int32_t values[MAX_LEN];
+    unsigned exp_indices[MAX_LEN];
+    uint8_t used[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const unsigned K = pseudo_rand_uint(&seed, 0, len+1);
+
+        // Sometimes only a few distinct values, so that there are many ties
+        const right_shift_t shr = (pseudo_rand_uint32(&seed) & 1)? 29 : pseudo_rand_uint(&seed, 0, 8);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> shr;
+
+        // Expected result is from repeatedly taking the argmax of the unselected elements
+        memset(used, 0, sizeof(used));
+        for(int j = 0; j < K; j++){
+            int best = -1;
+            for(int i = 0; i < len; i++){
+                if(used[i]) continue;
+                if(best < 0 || B[i] > B[best]) best = i;
+            }
+            used[best] = 1;
+            exp_indices[j] = best;
+        }
+
+        // Alternate between requesting values and not
+        xs3_vect_s32_topk(indices, (v & 1)? NULL : values, B, len, K);
+
+        if(K != 0)
+            TEST_ASSERT_EQUAL_UINT32_ARRAY(exp_indices, indices, K);
+
+        if(!(v & 1)){
+            for(int j = 0; j < K; j++)
+                TEST_ASSERT_EQUAL_INT32(B[exp_indices[j]], values[j]);
+        }
+    }
+}
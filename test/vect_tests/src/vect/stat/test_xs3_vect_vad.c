@@ -0,0 +1,153 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_vad) {
+  RUN_TEST_CASE(xs3_vect_vad, xs3_vect_s32_energy_zcr);
+  RUN_TEST_CASE(xs3_vect_vad, xs3_vect_s32_spectral_flatness);
+  RUN_TEST_CASE(xs3_vect_vad, xs3_vect_s32_spectral_flatness_full_scale);
+}
+
+TEST_GROUP(xs3_vect_vad);
+TEST_SETUP(xs3_vect_vad) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_vad) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (512)
+#endif
+
+
+TEST(xs3_vect_vad, xs3_vect_s32_energy_zcr)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN + 1);
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 28);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> b_hr;
+
+        // Some runs of zeros, which shouldn't count as crossings
+        for(int i = 0; i < len; i++)
+            if((pseudo_rand_uint32(&seed) & 0x7) == 0)
+                B[i] = 0;
+
+        unsigned expected_zc = 0;
+        for(int i = 1; i < len; i++)
+            expected_zc += ((B[i] < 0) != (B[i-1] < 0));
+
+        exponent_t e_exp;
+        right_shift_t b_shr;
+        xs3_vect_s32_energy_prepare(&e_exp, &b_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        unsigned zc;
+        const int64_t energy = xs3_vect_s32_energy_zcr(&zc, B, len, b_shr);
+
+        TEST_ASSERT_EQUAL_INT64(xs3_vect_s32_energy(B, len, b_shr), energy);
+        TEST_ASSERT_EQUAL_UINT(expected_zc, zc);
+    }
+}
+
+
+TEST(xs3_vect_vad, xs3_vect_s32_spectral_flatness)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN + 1);
+        setExtraInfo_RSL(v, seed, len);
+
+        // Alternate between flat-ish spectra and ones with a wide dynamic range (down to single-bit values)
+        const unsigned spread = (v & 1)? 4 : 30;
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 1, 4);
+
+        for(int i = 0; i < len; i++){
+            const unsigned shr = b_hr + pseudo_rand_uint(&seed, 0, spread);
+            B[i] = MAX(1, ((int32_t)(pseudo_rand_uint32(&seed) >> 1)) >> shr);
+        }
+
+        double log_sum = 0;
+        double sum = 0;
+        for(int i = 0; i < len; i++){
+            log_sum += log2(B[i]);
+            sum += B[i];
+        }
+        const double expected = pow(2, log_sum / len) / (sum / len);
+
+        const fixed_s32_t flatness = xs3_vect_s32_spectral_flatness(B, len);
+
+        TEST_ASSERT(flatness >= 0 && flatness <= 0x40000000);
+        TEST_ASSERT(fabs(ldexp(flatness, -30) - expected) <= ldexp(1, -13));
+
+        // A zero bin gives zero flatness
+        B[pseudo_rand_uint(&seed, 0, len)] = 0;
+        TEST_ASSERT_EQUAL_INT32(0, xs3_vect_s32_spectral_flatness(B, len));
+    }
+
+    // A perfectly flat spectrum
+    for(int i = 0; i < MAX_LEN; i++)
+        B[i] = 0x12345678;
+
+    TEST_ASSERT_INT32_WITHIN(1, 0x40000000, xs3_vect_s32_spectral_flatness(B, MAX_LEN));
+}
+
+
+#define FULL_SCALE_LEN    (1024)
+TEST(xs3_vect_vad, xs3_vect_s32_spectral_flatness_full_scale)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED B[FULL_SCALE_LEN];
+
+    // More than 256 bins with no headroom, so a 40-bit accumulator would saturate (e.g. the 257 bins of a
+    // 512-point FFT).
+    for(int v = 0; v < REPS / 10; v++){
+
+        const unsigned len = (v == 0)? 512 : pseudo_rand_uint(&seed, 257, FULL_SCALE_LEN + 1);
+        setExtraInfo_RSL(v, seed, len);
+
+        for(int i = 0; i < len; i++)
+            B[i] = (i & 1)? INT32_MAX - (pseudo_rand_uint32(&seed) >> 8) 
+                          : (INT32_MAX >> 2) - (pseudo_rand_uint32(&seed) >> 8);
+
+        double log_sum = 0;
+        double sum = 0;
+        for(int i = 0; i < len; i++){
+            log_sum += log2(B[i]);
+            sum += B[i];
+        }
+        const double expected = pow(2, log_sum / len) / (sum / len);
+
+        const fixed_s32_t flatness = xs3_vect_s32_spectral_flatness(B, len);
+
+        TEST_ASSERT(fabs(ldexp(flatness, -30) - expected) <= ldexp(1, -13));
+    }
+}
+#undef FULL_SCALE_LEN
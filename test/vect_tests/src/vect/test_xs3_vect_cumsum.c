@@ -0,0 +1,104 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_cumsum) {
+  RUN_TEST_CASE(xs3_vect_cumsum, xs3_vect_s32_cumsum_prepare);
+  RUN_TEST_CASE(xs3_vect_cumsum, xs3_vect_s32_cumsum);
+}
+
+TEST_GROUP(xs3_vect_cumsum);
+TEST_SETUP(xs3_vect_cumsum) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_cumsum) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (1024)
+#endif
+
+
+TEST(xs3_vect_cumsum, xs3_vect_s32_cumsum_prepare)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    for(int v = 0; v < REPS; v++){
+        setExtraInfo_RS(v, seed);
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, 5000);
+        const exponent_t b_exp = pseudo_rand_int(&seed, -40, 40);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 31);
+
+        exponent_t a_exp;
+        right_shift_t a_shr;
+
+        xs3_vect_s32_cumsum_prepare(&a_exp, &a_shr, len, b_exp, b_hr);
+
+        TEST_ASSERT_EQUAL(b_exp + a_shr, a_exp);
+
+        // The largest possible partial sum must fit after shifting, but with no more than 1 bit to spare
+        const int64_t worst = ((int64_t)len) << (31 - b_hr);
+        TEST_ASSERT(ldexp((double) worst, -a_shr) <= ldexp(1, 31));
+        TEST_ASSERT(ldexp((double) worst, -a_shr) > ldexp(1, 29));
+    }
+}
+
+
+TEST(xs3_vect_cumsum, xs3_vect_s32_cumsum)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    int32_t WORD_ALIGNED A[MAX_LEN];
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int32_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        const unsigned len = pseudo_rand_uint(&seed, 1, MAX_LEN + 1);
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 12);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> b_hr;
+
+        // Some reps use the shift from the prepare function, others an arbitrary one (which may saturate)
+        exponent_t a_exp;
+        right_shift_t a_shr;
+        xs3_vect_s32_cumsum_prepare(&a_exp, &a_shr, len, 0, xs3_vect_s32_headroom(B, len));
+
+        if(v & 2)
+            a_shr = pseudo_rand_int(&seed, -4, 12);
+
+        int64_t S = 0;
+        for(int i = 0; i < len; i++){
+            S += B[i];
+            int64_t s = (a_shr > 0)? ((S + (((int64_t)1) << (a_shr - 1))) >> a_shr) : (S * (1LL << -a_shr));
+            s = MIN(MAX(s, INT32_MIN + 1), INT32_MAX);
+            expected[i] = (int32_t) s;
+        }
+
+        // Alternate between out-of-place and in-place
+        int32_t* out = (v & 1)? B : A;
+        headroom_t hr = xs3_vect_s32_cumsum(out, B, len, a_shr);
+
+        TEST_ASSERT_EQUAL_INT32_ARRAY(expected, out, len);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(out, len), hr);
+    }
+}
@@ -0,0 +1,196 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "xs3_math.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+
+TEST_GROUP_RUNNER(xs3_vect_elementwise) {
+  RUN_TEST_CASE(xs3_vect_elementwise, xs3_vect_s32_max_elementwise_prepare);
+  RUN_TEST_CASE(xs3_vect_elementwise, xs3_vect_s32_max_elementwise_random);
+  RUN_TEST_CASE(xs3_vect_elementwise, xs3_vect_s32_min_elementwise_random);
+  RUN_TEST_CASE(xs3_vect_elementwise, xs3_vect_s32_select_random);
+}
+
+TEST_GROUP(xs3_vect_elementwise);
+TEST_SETUP(xs3_vect_elementwise) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_elementwise) {}
+
+
+static int32_t shr_s32(int32_t b, int b_shr)
+{
+    int64_t bp = b;
+
+    bp = (b_shr >= 0)? bp >> b_shr : bp << (-b_shr);
+    bp = (bp >= VPU_INT32_MAX)? VPU_INT32_MAX : (bp <= VPU_INT32_MIN)? VPU_INT32_MIN : bp;
+
+    return (int32_t) bp;
+}
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+TEST(xs3_vect_elementwise, xs3_vect_s32_max_elementwise_prepare)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    for(int v = 0; v < REPS; v++){
+
+        setExtraInfo_RS(v, seed);
+
+        const exponent_t b_exp = pseudo_rand_int(&seed, -40, 40);
+        const exponent_t c_exp = pseudo_rand_int(&seed, -40, 40);
+        const headroom_t b_hr = pseudo_rand_uint(&seed, 0, 31);
+        const headroom_t c_hr = pseudo_rand_uint(&seed, 0, 31);
+
+        exponent_t a_exp;
+        right_shift_t b_shr, c_shr;
+
+        xs3_vect_s32_max_elementwise_prepare(&a_exp, &b_shr, &c_shr, b_exp, c_exp, b_hr, c_hr);
+
+        // Output exponent is consistent with the shifts
+        TEST_ASSERT_EQUAL(a_exp, b_exp + b_shr);
+        TEST_ASSERT_EQUAL(a_exp, c_exp + c_shr);
+
+        // Neither input can saturate, and at least one of them has its headroom fully removed
+        TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, b_hr + b_shr);
+        TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, c_hr + c_shr);
+        TEST_ASSERT((b_hr + b_shr == 0) || (c_hr + c_shr == 0));
+    }
+}
+
+
+TEST(xs3_vect_elementwise, xs3_vect_s32_max_elementwise_random)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    headroom_t hr;
+    int32_t A[MAX_LEN];
+    int32_t B[MAX_LEN];
+    int32_t C[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        setExtraInfo_RS(v, seed);
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        
+        for(int i = 0; i < len; i++){
+            unsigned shr = pseudo_rand_uint32(&seed) % 8;
+            B[i] = pseudo_rand_int32(&seed) >> shr;
+            C[i] = pseudo_rand_int32(&seed) >> shr;
+        }
+
+        int b_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+        int c_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+
+        hr = xs3_vect_s32_max_elementwise(A, B, C, len, b_shr, c_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(MAX(shr_s32(B[i], b_shr), shr_s32(C[i], c_shr)), A[i]);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+
+        // In-place
+        memcpy(A, C, sizeof(A[0])*len);
+        hr = xs3_vect_s32_max_elementwise(A, B, A, len, b_shr, c_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(MAX(shr_s32(B[i], b_shr), shr_s32(C[i], c_shr)), A[i]);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+    }
+}
+
+
+TEST(xs3_vect_elementwise, xs3_vect_s32_min_elementwise_random)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    headroom_t hr;
+    int32_t A[MAX_LEN];
+    int32_t B[MAX_LEN];
+    int32_t C[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        setExtraInfo_RS(v, seed);
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        
+        for(int i = 0; i < len; i++){
+            unsigned shr = pseudo_rand_uint32(&seed) % 8;
+            B[i] = pseudo_rand_int32(&seed) >> shr;
+            C[i] = pseudo_rand_int32(&seed) >> shr;
+        }
+
+        int b_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+        int c_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+
+        hr = xs3_vect_s32_min_elementwise(A, B, C, len, b_shr, c_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(MIN(shr_s32(B[i], b_shr), shr_s32(C[i], c_shr)), A[i]);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+
+        // In-place
+        memcpy(A, B, sizeof(A[0])*len);
+        hr = xs3_vect_s32_min_elementwise(A, A, C, len, b_shr, c_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(MIN(shr_s32(B[i], b_shr), shr_s32(C[i], c_shr)), A[i]);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+    }
+}
+
+
+TEST(xs3_vect_elementwise, xs3_vect_s32_select_random)
+{
+    unsigned seed = SEED_FROM_FUNC_NAME();
+
+    headroom_t hr;
+    int32_t A[MAX_LEN];
+    int32_t B[MAX_LEN];
+    int32_t C[MAX_LEN];
+    int8_t mask[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        setExtraInfo_RS(v, seed);
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        
+        for(int i = 0; i < len; i++){
+            unsigned shr = pseudo_rand_uint32(&seed) % 8;
+            B[i] = pseudo_rand_int32(&seed) >> shr;
+            C[i] = pseudo_rand_int32(&seed) >> shr;
+            mask[i] = pseudo_rand_int8(&seed) >> 6;
+        }
+
+        int b_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+        int c_shr = (pseudo_rand_uint32(&seed) % 5) - 2;
+
+        // Masks are typically produced by xs3_vect_s8_is_negative()
+        xs3_vect_s8_is_negative(mask, mask, len);
+
+        hr = xs3_vect_s32_select(A, B, C, mask, len, b_shr, c_shr);
+
+        for(int i = 0; i < len; i++)
+            TEST_ASSERT_EQUAL_INT32(mask[i]? shr_s32(B[i], b_shr) : shr_s32(C[i], c_shr), A[i]);
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(A, len), hr);
+    }
+}
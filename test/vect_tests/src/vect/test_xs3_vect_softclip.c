@@ -0,0 +1,96 @@
+// Copyright 2021 XMOS LIMITED.
+// This Software is subject to the terms of the XMOS Public Licence: Version 1.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <math.h>
+
+#include "xs3_math.h"
+#include "xs3_vpu_scalar_ops.h"
+
+#include "../tst_common.h"
+
+#include "unity_fixture.h"
+
+TEST_GROUP_RUNNER(xs3_vect_softclip) {
+  RUN_TEST_CASE(xs3_vect_softclip, xs3_vect_s32_softclip_cubic);
+  RUN_TEST_CASE(xs3_vect_softclip, xs3_vect_s32_softclip_tanh);
+}
+
+TEST_GROUP(xs3_vect_softclip);
+TEST_SETUP(xs3_vect_softclip) { fflush(stdout); }
+TEST_TEAR_DOWN(xs3_vect_softclip) {}
+
+
+
+#if SMOKE_TEST
+#  define REPS       (100)
+#  define MAX_LEN    (64)
+#else
+#  define REPS       (1000)
+#  define MAX_LEN    (256)
+#endif
+
+
+static double softclip_cubic(double u)
+{
+    if(u >= 1)  return 1;
+    if(u <= -1) return -1;
+    return (3 * u - u * u * u) / 2;
+}
+
+
+static void test_softclip(
+    const softclip_curve_e curve,
+    double (*f)(double),
+    const int32_t threshold,
+    unsigned seed)
+{
+    int32_t WORD_ALIGNED A[MAX_LEN];
+    int32_t WORD_ALIGNED B[MAX_LEN];
+    int32_t expected[MAX_LEN];
+
+    for(int v = 0; v < REPS; v++){
+
+        unsigned len = (pseudo_rand_uint32(&seed) % MAX_LEN) + 1;
+        setExtraInfo_RSL(v, seed, len);
+
+        const headroom_t hr = pseudo_rand_uint(&seed, 0, 8);
+        const right_shift_t b_shr = pseudo_rand_int(&seed, -4, 4);
+
+        for(int i = 0; i < len; i++)
+            B[i] = pseudo_rand_int32(&seed) >> hr;
+
+        for(int i = 0; i < len; i++){
+            const double u = ldexp(vlashr32(B[i], b_shr), -30);
+            expected[i] = (int32_t) lround(ldexp(f(u), 30));
+        }
+
+        // Alternate between out-of-place and in-place
+        int32_t* out = (v & 1)? B : A;
+        headroom_t res_hr = xs3_vect_s32_softclip(out, B, len, b_shr, curve);
+
+        for(int i = 0; i < len; i++){
+            TEST_ASSERT_INT32_WITHIN(threshold, expected[i], out[i]);
+            TEST_ASSERT(out[i] >= -0x40000000 && out[i] <= 0x40000000);
+        }
+
+        TEST_ASSERT_EQUAL(xs3_vect_s32_headroom(out, len), res_hr);
+    }
+}
+
+
+TEST(xs3_vect_softclip, xs3_vect_s32_softclip_cubic)
+{
+    test_softclip(SOFTCLIP_CUBIC, softclip_cubic, 4, SEED_FROM_FUNC_NAME());
+}
+
+
+TEST(xs3_vect_softclip, xs3_vect_s32_softclip_tanh)
+{
+    // Linear interpolation error is a few parts per million of full scale
+    test_softclip(SOFTCLIP_TANH, tanh, 0x2000, SEED_FROM_FUNC_NAME());
+}